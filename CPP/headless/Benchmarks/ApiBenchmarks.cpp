@@ -0,0 +1,578 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Microbenchmarks of the client side of the API: the inline wrappers, Ptr and the marshalling of
+// arrays, collections and strings. They run against the headless implementation, so they measure
+// the cost of the wrapper layer and the raw interface rather than of the host.
+//
+// Build with optimization, from the root of the repository:
+//
+//     g++ -std=c++17 -O2 -DNDEBUG -I CPP/include -I CPP/headless/Core -I CPP/headless/Core/Geometry
+//         CPP/headless/Benchmarks/ApiBenchmarks.cpp -o ApiBenchmarks -pthread
+//
+// Options:
+//     --filter=<text>       Only run the benchmarks whose name contains text.
+//     --min-time=<ms>       Minimum duration of each measurement, 200 by default.
+//     --repetitions=<n>     Number of measurements of each benchmark, 5 by default.
+//     --format=json|csv     Output format, json by default.
+//     --list                Print the names of the benchmarks.
+//
+// The json output is one object per line. The first line describes the run and each of the
+// following lines is a benchmark result, with the median and minimum time per item in
+// nanoseconds. An item is one call, one element of a batch or one element of a collection, so
+// single and batched variants of the same operation can be compared directly. Results from two
+// API versions can be compared by joining the lines on the benchmark name.
+
+#include <HeadlessCore.h>
+#include <Core/CollectionView.h>
+#include <Core/Application/AsyncLog.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace adsk::core;
+
+namespace {
+
+// Keeps the compiler from optimizing away a value that the benchmark computes but doesn't use.
+template <class T>
+inline void keep(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+struct Benchmark
+{
+    std::string name;
+
+    // The number of items processed by one iteration of run.
+    size_t itemsPerIteration;
+
+    // Runs the benchmark for a number of iterations.
+    std::function<void(size_t iterations)> run;
+};
+
+struct Options
+{
+    std::string filter;
+    double minTimeMs = 200.0;
+    int repetitions = 5;
+    bool csv = false;
+    bool list = false;
+};
+
+double elapsedNs(const std::function<void(size_t)>& run, size_t iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    run(iterations);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+// Finds a number of iterations that takes at least the minimum time.
+size_t calibrate(const Benchmark& benchmark, double minTimeNs)
+{
+    size_t iterations = 1;
+    for (;;)
+    {
+        double ns = elapsedNs(benchmark.run, iterations);
+        if (ns >= minTimeNs)
+            return iterations;
+        double factor = ns > 0.0 ? 1.4 * minTimeNs / ns : 100.0;
+        factor = std::min(100.0, std::max(2.0, factor));
+        iterations = static_cast<size_t>(iterations * factor);
+    }
+}
+
+std::string escape(const std::string& text)
+{
+    std::string res;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            res += '\\';
+        res += c;
+    }
+    return res;
+}
+
+const char* compilerName()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+}
+
+void printHeader(const Options& options)
+{
+#ifdef NDEBUG
+    const char* build = "release";
+#else
+    const char* build = "debug";
+#endif
+    if (options.csv)
+    {
+        std::printf("benchmark,items_per_iteration,iterations,repetitions,median_ns_per_item,min_ns_per_item\n");
+        return;
+    }
+    std::printf("{\"suite\":\"adsk-core-api\",\"implementation\":\"headless\",\"compiler\":\"%s\",\"build\":\"%s\","
+                "\"min_time_ms\":%g,\"repetitions\":%d}\n",
+                escape(compilerName()).c_str(), build, options.minTimeMs, options.repetitions);
+}
+
+void runBenchmark(const Benchmark& benchmark, const Options& options)
+{
+    size_t iterations = calibrate(benchmark, options.minTimeMs * 1.0e6);
+    std::vector<double> nsPerItem;
+    for (int i = 0; i < options.repetitions; ++i)
+        nsPerItem.push_back(elapsedNs(benchmark.run, iterations) / (static_cast<double>(iterations) * benchmark.itemsPerIteration));
+    std::sort(nsPerItem.begin(), nsPerItem.end());
+    double median = nsPerItem[nsPerItem.size() / 2];
+    if (nsPerItem.size() % 2 == 0)
+        median = 0.5 * (median + nsPerItem[nsPerItem.size() / 2 - 1]);
+
+    if (options.csv)
+    {
+        std::printf("%s,%zu,%zu,%d,%.3f,%.3f\n", benchmark.name.c_str(), benchmark.itemsPerIteration, iterations,
+                    options.repetitions, median, nsPerItem.front());
+    }
+    else
+    {
+        std::printf("{\"benchmark\":\"%s\",\"items_per_iteration\":%zu,\"iterations\":%zu,\"repetitions\":%d,"
+                    "\"median_ns_per_item\":%.3f,\"min_ns_per_item\":%.3f}\n",
+                    escape(benchmark.name).c_str(), benchmark.itemsPerIteration, iterations, options.repetitions,
+                    median, nsPerItem.front());
+    }
+    std::fflush(stdout);
+}
+
+// The size of the batches and collections.
+const size_t batchSize = 256;
+
+std::vector<double> batchParameters(const Ptr<CurveEvaluator3D>& evaluator)
+{
+    double start = 0.0, end = 0.0;
+    evaluator->getParameterExtents(start, end);
+    std::vector<double> res(batchSize);
+    for (size_t i = 0; i < batchSize; ++i)
+        res[i] = start + (end - start) * i / (batchSize - 1);
+    return res;
+}
+
+Ptr<NurbsCurve3D> testCurve()
+{
+    Ptr<Arc3D> arc = Arc3D::createByCenter(Point3D::create(0.0, 0.0, 0.0), Vector3D::create(0.0, 0.0, 1.0),
+                                           Vector3D::create(1.0, 0.0, 0.0), 5.0, 0.0, 4.0);
+    return arc->asNurbsCurve();
+}
+
+void addWrapperBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    benchmarks.push_back({ "ptr/create_release", 1, [](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            Ptr<Point3D> point = Point3D::create(1.0, 2.0, 3.0);
+            keep(point);
+        }
+    } });
+
+    Ptr<Point3D> point = Point3D::create(1.0, 2.0, 3.0);
+    benchmarks.push_back({ "ptr/copy", 1, [point](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            Ptr<Point3D> copy = point;
+            keep(copy);
+        }
+    } });
+
+    benchmarks.push_back({ "ptr/move", 1, [point](size_t iterations) {
+        Ptr<Point3D> a = point;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            Ptr<Point3D> b = std::move(a);
+            a = std::move(b);
+            keep(a);
+        }
+    } });
+
+    Ptr<Curve3D> curve = testCurve();
+    benchmarks.push_back({ "ptr/query_interface", 1, [curve](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            Ptr<NurbsCurve3D> nurbs = curve;
+            keep(nurbs);
+        }
+    } });
+
+    benchmarks.push_back({ "ptr/call_double", 1, [point](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            double x = point->x();
+            keep(x);
+        }
+    } });
+
+    benchmarks.push_back({ "array/as_array_deallocate", 1, [point](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            std::vector<double> coordinates = point->asArray();
+            keep(coordinates);
+        }
+    } });
+
+    benchmarks.push_back({ "array/get_as_array_buffer", 1, [point](size_t iterations) {
+        double coordinates[3];
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            point->getAsArray(coordinates);
+            keep(coordinates);
+        }
+    } });
+}
+
+void addEvaluatorBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    Ptr<CurveEvaluator3D> evaluator = testCurve()->evaluator();
+    std::vector<double> parameters = batchParameters(evaluator);
+
+    benchmarks.push_back({ "evaluator/point_single", batchSize, [evaluator, parameters](size_t iterations) {
+        Ptr<Point3D> point;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            for (double parameter : parameters)
+            {
+                evaluator->getPointAtParameter(parameter, point);
+                keep(point);
+            }
+        }
+    } });
+
+    benchmarks.push_back({ "evaluator/points_batched_ptr", batchSize, [evaluator, parameters](size_t iterations) {
+        std::vector<Ptr<Point3D>> points;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            evaluator->getPointsAtParameters(parameters, points);
+            keep(points);
+        }
+    } });
+
+    benchmarks.push_back({ "evaluator/points_batched_flat", batchSize, [evaluator, parameters](size_t iterations) {
+        std::vector<double> points;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            evaluator->getPointsAtParameters(parameters, points);
+            keep(points);
+        }
+    } });
+
+    benchmarks.push_back({ "evaluator/points_batched_buffer", batchSize, [evaluator, parameters](size_t iterations) {
+        std::vector<double> points(3 * parameters.size());
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            evaluator->getPointsAtParameters(&parameters[0], parameters.size(), &points[0]);
+            keep(points);
+        }
+    } });
+
+    benchmarks.push_back({ "evaluator/first_derivative_single", batchSize, [evaluator, parameters](size_t iterations) {
+        Ptr<Vector3D> derivative;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            for (double parameter : parameters)
+            {
+                evaluator->getFirstDerivative(parameter, derivative);
+                keep(derivative);
+            }
+        }
+    } });
+
+    benchmarks.push_back({ "evaluator/first_derivatives_batched", batchSize, [evaluator, parameters](size_t iterations) {
+        std::vector<Ptr<Vector3D>> derivatives;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            evaluator->getFirstDerivatives(parameters, derivatives);
+            keep(derivatives);
+        }
+    } });
+}
+
+// Runs a function on a number of threads at once and waits for them to finish.
+void runOnThreads(unsigned threadCount, const std::function<void(unsigned thread)>& function)
+{
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < threadCount; ++i)
+        threads.emplace_back(function, i);
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+// Measures the throughput of work spread over all of the cores. The time per item is the elapsed
+// time divided by the items processed by all threads, so it falls as the work scales.
+void addThreadBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    unsigned threadCount = std::max(2u, std::thread::hardware_concurrency());
+    Ptr<NurbsCurve3D> curve = testCurve();
+    std::vector<double> parameters = batchParameters(curve->evaluator());
+
+    benchmarks.push_back({ "threads/points_detached_evaluators", batchSize * threadCount, [curve, parameters, threadCount](size_t iterations) {
+        runOnThreads(threadCount, [&](unsigned) {
+            Ptr<CurveEvaluator3D> evaluator = curve->detachedEvaluator();
+            std::vector<double> points(3 * parameters.size());
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                evaluator->getPointsAtParameters(&parameters[0], parameters.size(), &points[0]);
+                keep(points);
+            }
+        });
+    } });
+
+    // Every thread evaluates through the same evaluator, which is allowed because the calls are const.
+    Ptr<CurveEvaluator3D> shared = curve->evaluator();
+    benchmarks.push_back({ "threads/points_shared_evaluator", batchSize * threadCount, [shared, parameters, threadCount](size_t iterations) {
+        runOnThreads(threadCount, [&](unsigned) {
+            std::vector<double> points(3 * parameters.size());
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                shared->getPointsAtParameters(&parameters[0], parameters.size(), &points[0]);
+                keep(points);
+            }
+        });
+    } });
+
+    // All threads add and release references to one object, so the reference count is contended.
+    Ptr<Point3D> point = Point3D::create(1.0, 2.0, 3.0);
+    benchmarks.push_back({ "threads/ptr_copy_contended", threadCount, [point, threadCount](size_t iterations) {
+        runOnThreads(threadCount, [&](unsigned) {
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                Ptr<Point3D> copy = point;
+                keep(copy);
+            }
+        });
+    } });
+}
+
+void addCollectionBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    std::vector<Ptr<Base>> items;
+    for (size_t i = 0; i < batchSize; ++i)
+        items.push_back(Point3D::create(static_cast<double>(i), 0.0, 0.0));
+    Ptr<ObjectCollection> collection = ObjectCollection::createWithArray(items);
+
+    benchmarks.push_back({ "collection/item_loop", batchSize, [collection](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            for (size_t j = 0, n = collection->count(); j < n; ++j)
+            {
+                Ptr<Base> item = collection->item(j);
+                keep(item);
+            }
+        }
+    } });
+
+    benchmarks.push_back({ "collection/copy_to", batchSize, [collection](size_t iterations) {
+        std::vector<Ptr<Base>> copy;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            copy.clear();
+            collection->copyTo(std::back_inserter(copy));
+            keep(copy);
+        }
+    } });
+
+    benchmarks.push_back({ "collection/as_array", batchSize, [collection](size_t iterations) {
+        std::vector<Ptr<Base>> copy;
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            collection->asArray(copy);
+            keep(copy);
+        }
+    } });
+
+    benchmarks.push_back({ "collection/view", batchSize, [collection](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            for (const Ptr<Base>& item : view(collection))
+                keep(item);
+        }
+    } });
+
+    // Repeated passes over one view, which is what prefetch is for.
+    benchmarks.push_back({ "collection/view_prefetched", batchSize, [collection](size_t iterations) {
+        CollectionView<ObjectCollection> items = view(collection);
+        items.prefetch();
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            for (const Ptr<Base>& item : items)
+                keep(item);
+        }
+    } });
+
+    benchmarks.push_back({ "collection/create_with_array", batchSize, [items](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            Ptr<ObjectCollection> copy = ObjectCollection::createWithArray(items);
+            keep(copy);
+        }
+    } });
+}
+
+void addStringBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    // The short value fits in the small string buffer of the common standard libraries, so the
+    // difference between the lengths measures the cost of the heap allocation made for the result.
+    // The getValue variants reuse the caller's storage and don't allocate.
+    const size_t lengths[] = { 8, 256, 4096 };
+    for (size_t length : lengths)
+    {
+        Ptr<Attribute> attribute = headless::newAttribute("group", "name", std::string(length, 'x'));
+        benchmarks.push_back({ "string/value_" + std::to_string(length), 1, [attribute](size_t iterations) {
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                std::string value = attribute->value();
+                keep(value);
+            }
+        } });
+
+        benchmarks.push_back({ "string/get_value_reused_" + std::to_string(length), 1, [attribute](size_t iterations) {
+            std::string value;
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                attribute->getValue(value);
+                keep(value);
+            }
+        } });
+
+        benchmarks.push_back({ "string/get_value_buffer_" + std::to_string(length), 1, [attribute](size_t iterations) {
+            char buffer[8192];
+            size_t valueLength = 0;
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                attribute->getValue(buffer, sizeof(buffer), valueLength);
+                keep(buffer);
+            }
+        } });
+    }
+
+    Ptr<Attribute> attribute = headless::newAttribute("group", "name", "value");
+    benchmarks.push_back({ "string/set_value", 1, [attribute](size_t iterations) {
+        std::string value = "value";
+        for (size_t i = 0; i < iterations; ++i)
+            attribute->value(value);
+    } });
+}
+
+// Discards the records, so the log benchmarks measure the cost to the writing thread.
+class NullLogSink : public AsyncLogSink {
+public:
+    void write(const LogRecord& record) override { keep(record); }
+};
+
+void addLogBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    std::shared_ptr<AsyncLog> log(new AsyncLog(1 << 20));
+    log->addSink(std::unique_ptr<AsyncLogSink>(new NullLogSink()));
+    log->level(WarningLogLevel);
+
+    benchmarks.push_back({ "log/write_filtered", 1, [log](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            bool written = log->write(InfoLogLevel, "evaluated", { { "index", i }, { "value", 0.5 } });
+            keep(written);
+        }
+    } });
+
+    // The log is drained on the benchmark thread between batches, which isn't timed separately, so
+    // this includes the cost of draining.
+    benchmarks.push_back({ "log/write_fields", 1, [log](size_t iterations) {
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            if (!log->write(WarningLogLevel, "evaluated", { { "index", i }, { "value", 0.5 } }))
+                log->flush();
+        }
+        log->flush();
+    } });
+}
+
+bool parseOptions(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg.compare(0, 9, "--filter=") == 0)
+            options.filter = arg.substr(9);
+        else if (arg.compare(0, 11, "--min-time=") == 0)
+            options.minTimeMs = std::atof(arg.c_str() + 11);
+        else if (arg.compare(0, 14, "--repetitions=") == 0)
+            options.repetitions = std::atoi(arg.c_str() + 14);
+        else if (arg == "--format=csv")
+            options.csv = true;
+        else if (arg == "--format=json")
+            options.csv = false;
+        else if (arg == "--list")
+            options.list = true;
+        else
+        {
+            std::fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return false;
+        }
+    }
+    return options.minTimeMs > 0.0 && options.repetitions > 0;
+}
+
+}// namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+        return 2;
+
+    std::vector<Benchmark> benchmarks;
+    addWrapperBenchmarks(benchmarks);
+    addEvaluatorBenchmarks(benchmarks);
+    addCollectionBenchmarks(benchmarks);
+    addStringBenchmarks(benchmarks);
+    addThreadBenchmarks(benchmarks);
+    addLogBenchmarks(benchmarks);
+
+    if (options.list)
+    {
+        for (const Benchmark& benchmark : benchmarks)
+            std::printf("%s\n", benchmark.name.c_str());
+        return 0;
+    }
+
+    printHeader(options);
+    for (const Benchmark& benchmark : benchmarks)
+    {
+        if (benchmark.name.find(options.filter) != std::string::npos)
+            runBenchmark(benchmark, options);
+    }
+    return 0;
+}
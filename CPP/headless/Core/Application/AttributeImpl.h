@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Application/Attribute.h>
+#include "ObjectCollectionImpl.h"
+#include <cstring>
+#include <string>
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// Returns a copy of a string allocated the way the raw interface returns strings, to be freed by
+/// the caller with DeallocateArray.
+inline char* newString(const std::string& value)
+{
+    char* res = new char[value.size() + 1];
+    std::memcpy(res, value.c_str(), value.size() + 1);
+    return res;
+}
+
+/// Copies a string into a buffer following the contract of the raw string getters: the length is
+/// always returned, and nothing is written unless the string and its terminating null fit.
+inline bool copyString(const std::string& value, char* buffer, size_t capacity, size_t& length)
+{
+    length = value.size();
+    if (length + 1 > capacity)
+        return true;
+    if (!buffer)
+        return false;
+    std::memcpy(buffer, value.c_str(), length + 1);
+    return true;
+}
+
+/// Attribute that isn't attached to an entity, so it has no parents and can't be deleted. In the
+/// host attributes are created through Attributes.add; here they are created with newAttribute.
+class AttributeImpl : public Attribute {
+public:
+    AttributeImpl(const std::string& groupName, const std::string& name, const std::string& value)
+        : m_groupName(groupName), m_name(name), m_value(value)
+    {}
+
+private:
+    char* groupName_raw() const override { return newString(m_groupName); }
+    char* name_raw() const override { return newString(m_name); }
+    char* value_raw() const override { return newString(m_value); }
+
+    bool value_raw(const char* value) override
+    {
+        if (!value)
+            return false;
+        m_value = value;
+        return true;
+    }
+
+    Base* parent_raw() const override { return nullptr; }
+    bool deleteMe_raw() override { return false; }
+    ObjectCollection* otherParents_raw() const override { return ObjectCollection::create().detach(); }
+    bool getGroupName_raw(char* buffer, size_t capacity, size_t& length) const override { return copyString(m_groupName, buffer, capacity, length); }
+    bool getName_raw(char* buffer, size_t capacity, size_t& length) const override { return copyString(m_name, buffer, capacity, length); }
+    bool getValue_raw(char* buffer, size_t capacity, size_t& length) const override { return copyString(m_value, buffer, capacity, length); }
+
+    std::string m_groupName;
+    std::string m_name;
+    std::string m_value;
+};
+
+/// Creates an attribute.
+inline Ptr<Attribute> newAttribute(const std::string& groupName, const std::string& name, const std::string& value)
+{
+    return Ptr<Attribute>(new AttributeImpl(groupName, name, value));
+}
+
+}// namespace headless
+
+inline const char* Attribute::classType() { return "adsk::core::Attribute"; }
+inline const char* Attribute::objectType() const { return classType(); }
+
+inline void* Attribute::queryInterface(const char* id) const
+{
+    if (isInterface(id, Attribute::classType()))
+        return const_cast<Attribute*>(this);
+    if (isInterface(id, Base::classType()))
+        return static_cast<Base*>(const_cast<Attribute*>(this));
+    return nullptr;
+}
+
+}// namespace core
+}// namespace adsk
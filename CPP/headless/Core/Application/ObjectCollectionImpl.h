@@ -0,0 +1,152 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Application/ObjectCollection.h>
+#include <algorithm>
+#include <vector>
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+class ObjectCollectionImpl : public ObjectCollection {
+public:
+    ObjectCollectionImpl() {}
+
+private:
+    Base* item_raw(size_t index) const override
+    {
+        if (index >= m_items.size())
+            return nullptr;
+        Base* res = m_items[index].get();
+        res->addref();
+        return res;
+    }
+
+    size_t count_raw() const override { return m_items.size(); }
+
+    bool add_raw(Base* item) override
+    {
+        if (!item)
+            return false;
+        m_items.push_back(Ptr<Base>(item, false));
+        return true;
+    }
+
+    bool removeByItem_raw(Base* item) override
+    {
+        int index = find_raw(item, 0);
+        if (index < 0)
+            return false;
+        m_items.erase(m_items.begin() + index);
+        return true;
+    }
+
+    bool removeByIndex_raw(size_t index) override
+    {
+        if (index >= m_items.size())
+            return false;
+        m_items.erase(m_items.begin() + index);
+        return true;
+    }
+
+    int find_raw(Base* item, size_t startIndex) const override
+    {
+        for (size_t i = startIndex; i < m_items.size(); ++i)
+        {
+            if (m_items[i].get() == item)
+                return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    bool contains_raw(Base* item) const override { return find_raw(item, 0) >= 0; }
+
+    bool clear_raw() override
+    {
+        m_items.clear();
+        return true;
+    }
+
+    Base** asArray_raw(size_t& return_size) const override
+    {
+        return_size = m_items.size();
+        Base** res = new Base*[return_size];
+        for (size_t i = 0; i < return_size; ++i)
+        {
+            res[i] = m_items[i].get();
+            res[i]->addref();
+        }
+        return res;
+    }
+
+    bool asArrayToBuffer_raw(Base** items, size_t capacity, size_t& count) const override
+    {
+        count = m_items.size();
+        if (count > capacity)
+            return true;
+        if (count > 0 && !items)
+            return false;
+        for (size_t i = 0; i < count; ++i)
+        {
+            items[i] = m_items[i].get();
+            items[i]->addref();
+        }
+        return true;
+    }
+
+    bool addArray_raw(Base** items, size_t items_size) override
+    {
+        if (items_size > 0 && !items)
+            return false;
+        if (std::find(items, items + items_size, nullptr) != items + items_size)
+            return false;
+        m_items.reserve(m_items.size() + items_size);
+        for (size_t i = 0; i < items_size; ++i)
+            m_items.push_back(Ptr<Base>(items[i], false));
+        return true;
+    }
+
+    std::vector<Ptr<Base>> m_items;
+};
+
+}// namespace headless
+
+inline const char* ObjectCollection::classType() { return "adsk::core::ObjectCollection"; }
+inline const char* ObjectCollection::objectType() const { return classType(); }
+
+inline void* ObjectCollection::queryInterface(const char* id) const
+{
+    if (isInterface(id, ObjectCollection::classType()))
+        return const_cast<ObjectCollection*>(this);
+    if (isInterface(id, Base::classType()))
+        return static_cast<Base*>(const_cast<ObjectCollection*>(this));
+    return nullptr;
+}
+
+inline ObjectCollection* ObjectCollection::create_raw()
+{
+    return new headless::ObjectCollectionImpl();
+}
+
+inline ObjectCollection* ObjectCollection::createWithArray_raw(Base** array, size_t array_size)
+{
+    ObjectCollection* res = new headless::ObjectCollectionImpl();
+    if (!res->addArray_raw(array, array_size))
+    {
+        res->release();
+        return nullptr;
+    }
+    return res;
+}
+
+}// namespace core
+}// namespace adsk
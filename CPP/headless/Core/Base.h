@@ -0,0 +1,180 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+// Stand-in for the Base.h that ships with Fusion, used to build API clients without the host
+// application. See Geometry/HeadlessGeometry.h for how to use it.
+
+namespace adsk { namespace core {
+
+/// Base class of every API object. Objects are reference counted and are destroyed when the last
+/// reference is released. An object starts with one reference, which is owned by the code that
+/// created it; this matches the raw interface, which returns objects the caller has to release.
+///
+/// The reference count is atomic, so references to an object can be added and released on several
+/// threads at once, as described for transient geometry in CurveEvaluator3D.h.
+class Base {
+public:
+
+    virtual const char* objectType() const = 0;
+    virtual void* queryInterface(const char* id) const = 0;
+
+    static const char* classType() { return "adsk::core::Base"; }
+    static const char* interfaceId() { return classType(); }
+
+    /// Indicates if the object is still valid. Objects of the headless implementation are always valid.
+    bool isValid() const { return true; }
+
+    void addref() const { m_refCount.fetch_add(1, std::memory_order_relaxed); }
+
+    // Releasing synchronizes with the other releases, so the changes every thread made to the object
+    // are visible to the thread that deletes it.
+    void release() const
+    {
+        if (m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this;
+    }
+
+    /// Returns the number of references to the object. The value can be out of date as soon as it is
+    /// returned if other threads hold references.
+    long refCount() const { return m_refCount.load(std::memory_order_relaxed); }
+
+protected:
+    Base() : m_refCount(1) {}
+    Base(const Base&) : m_refCount(1) {}
+    Base& operator=(const Base&) { return *this; }
+    virtual ~Base() {}
+
+    /// Helper for the queryInterface implementations.
+    static bool isInterface(const char* id, const char* type)
+    {
+        return id == type || (id && std::strcmp(id, type) == 0);
+    }
+
+private:
+    mutable std::atomic<long> m_refCount;
+};
+
+/// Smart pointer that holds a reference to an API object.
+///
+/// Constructing a Ptr from a raw pointer takes over the reference the raw interface returned with
+/// the object. Constructing a Ptr from a Ptr of another type uses queryInterface, so it results in
+/// a null Ptr if the object doesn't support the requested interface.
+template <class T>
+class Ptr {
+public:
+    typedef T element_type;
+
+    Ptr() : m_ptr(nullptr) {}
+
+    Ptr(T* ptr, bool attach = true) : m_ptr(ptr)
+    {
+        if (m_ptr && !attach)
+            toBase(m_ptr)->addref();
+    }
+
+    Ptr(const Ptr& other) : m_ptr(other.m_ptr)
+    {
+        if (m_ptr)
+            toBase(m_ptr)->addref();
+    }
+
+    Ptr(Ptr&& other) : m_ptr(other.m_ptr)
+    {
+        other.m_ptr = nullptr;
+    }
+
+    template <class U>
+    Ptr(const Ptr<U>& other) : m_ptr(nullptr)
+    {
+        if (other)
+        {
+            m_ptr = static_cast<T*>(toBase(other.get())->queryInterface(T::interfaceId()));
+            if (m_ptr)
+                toBase(m_ptr)->addref();
+        }
+    }
+
+    ~Ptr() { reset(); }
+
+    Ptr& operator=(const Ptr& other)
+    {
+        Ptr tmp(other);
+        swap(tmp);
+        return *this;
+    }
+
+    Ptr& operator=(Ptr&& other)
+    {
+        Ptr tmp(std::move(other));
+        swap(tmp);
+        return *this;
+    }
+
+    Ptr& operator=(T* ptr)
+    {
+        Ptr tmp(ptr);
+        swap(tmp);
+        return *this;
+    }
+
+    void reset()
+    {
+        if (m_ptr)
+        {
+            T* ptr = m_ptr;
+            m_ptr = nullptr;
+            toBase(ptr)->release();
+        }
+    }
+
+    /// Releases ownership of the object without releasing the reference.
+    T* detach()
+    {
+        T* ptr = m_ptr;
+        m_ptr = nullptr;
+        return ptr;
+    }
+
+    void swap(Ptr& other) { std::swap(m_ptr, other.m_ptr); }
+
+    T* get() const { return m_ptr; }
+    T* operator->() const { return m_ptr; }
+    T& operator*() const { return *m_ptr; }
+    bool isValid() const { return m_ptr != nullptr; }
+    explicit operator bool() const { return m_ptr != nullptr; }
+
+    bool operator==(const Ptr& other) const { return m_ptr == other.m_ptr; }
+    bool operator!=(const Ptr& other) const { return m_ptr != other.m_ptr; }
+    bool operator==(std::nullptr_t) const { return m_ptr == nullptr; }
+    bool operator!=(std::nullptr_t) const { return m_ptr != nullptr; }
+
+private:
+    // Every API interface derives from Base alone, so the Base subobject is at the start of the
+    // object. This lets Ptr be used with interfaces that are only forward declared.
+    static const Base* toBase(const void* ptr) { return static_cast<const Base*>(ptr); }
+
+    T* m_ptr;
+};
+
+/// Frees an array returned by the raw interface.
+template <class T>
+inline void DeallocateArray(T* p)
+{
+    delete[] p;
+}
+
+}// namespace core
+}// namespace adsk
@@ -0,0 +1,272 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/Arc3D.h>
+#include "NurbsCurve3DImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// Circular arc parameterized by angle, so the parameter extents are the start and end angles. The
+/// angles are measured counterclockwise about the normal from the reference vector.
+class Arc3DImpl : public Arc3D, public CurveGeometry {
+public:
+    Arc3DImpl(const Vec3& center, const Vec3& normal, const Vec3& referenceVector, double radius, double startAngle, double endAngle)
+        : m_center(center), m_normal(normal), m_reference(referenceVector), m_radius(radius), m_startAngle(startAngle), m_endAngle(endAngle)
+    {}
+
+    /// Checks and normalizes the axes of an arc. The reference vector must be perpendicular to the normal.
+    static bool makeAxes(Vec3& normal, Vec3& referenceVector)
+    {
+        return normalize(normal) && normalize(referenceVector) && isPerpendicular(normal, referenceVector);
+    }
+
+    void extents(double& startParameter, double& endParameter) const override
+    {
+        startParameter = m_startAngle;
+        endParameter = m_endAngle;
+    }
+
+    void evaluate(double parameter, int order, Vec3* values) const override
+    {
+        Vec3 yAxis = cross(m_normal, m_reference);
+        double c = std::cos(parameter) * m_radius;
+        double s = std::sin(parameter) * m_radius;
+        values[0] = m_center + m_reference * c + yAxis * s;
+        // Each derivative rotates the radius vector a quarter turn.
+        for (int k = 1; k <= order; ++k)
+        {
+            double t = c;
+            c = -s;
+            s = t;
+            values[k] = m_reference * c + yAxis * s;
+        }
+    }
+
+    int samplesPerSpan() const override { return 16; }
+
+private:
+    Curve3DTypes curveType_raw() const override { return Arc3DCurveType; }
+    CurveEvaluator3D* evaluator_raw() const override { return new CurveEvaluator3DImpl(this, this); }
+
+    CurveEvaluator3D* detachedEvaluator_raw() const override
+    {
+        Arc3DImpl* copy = new Arc3DImpl(m_center, m_normal, m_reference, m_radius, m_startAngle, m_endAngle);
+        CurveEvaluator3D* res = new CurveEvaluator3DImpl(copy, copy);
+        copy->release();
+        return res;
+    }
+
+    // Only transformations that keep the arc circular, made of rotation, translation, mirroring and
+    // uniform scaling, are supported.
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        if (!matrix)
+            return false;
+        Mat4 m = valueOf(matrix);
+        Vec3 xAxis = transformVector(m, m_reference);
+        Vec3 yAxis = transformVector(m, cross(m_normal, m_reference));
+        double scale = length(xAxis);
+        if (scale <= 0.0 || std::fabs(length(yAxis) - scale) > angleTolerance * scale || !isPerpendicular(xAxis, yAxis))
+            return false;
+        m_center = transformPoint(m, m_center);
+        m_reference = xAxis * (1.0 / scale);
+        m_normal = cross(xAxis, yAxis);
+        normalize(m_normal);
+        m_radius *= scale;
+        return true;
+    }
+
+    Point3D* center_raw() const override { return newPoint(m_center); }
+
+    bool center_raw(Point3D* value) override
+    {
+        if (!value)
+            return false;
+        m_center = valueOf(value);
+        return true;
+    }
+
+    Vector3D* normal_raw() const override { return newVector(m_normal); }
+    Vector3D* referenceVector_raw() const override { return newVector(m_reference); }
+
+    bool setAxes_raw(Vector3D* normal, Vector3D* referenceVector) override
+    {
+        if (!normal || !referenceVector)
+            return false;
+        Vec3 n = valueOf(normal);
+        Vec3 r = valueOf(referenceVector);
+        if (!makeAxes(n, r))
+            return false;
+        m_normal = n;
+        m_reference = r;
+        return true;
+    }
+
+    double radius_raw() const override { return m_radius; }
+
+    bool radius_raw(double value) override
+    {
+        if (!(value > 0.0))
+            return false;
+        m_radius = value;
+        return true;
+    }
+
+    double startAngle_raw() const override { return m_startAngle; }
+
+    bool startAngle_raw(double value) override
+    {
+        m_startAngle = value;
+        return true;
+    }
+
+    double endAngle_raw() const override { return m_endAngle; }
+
+    bool endAngle_raw(double value) override
+    {
+        m_endAngle = value;
+        return true;
+    }
+
+    Point3D* startPoint_raw() const override { return newPoint(pointAt(m_startAngle)); }
+    Point3D* endPoint_raw() const override { return newPoint(pointAt(m_endAngle)); }
+
+    Arc3D* copy_raw() const override { return new Arc3DImpl(m_center, m_normal, m_reference, m_radius, m_startAngle, m_endAngle); }
+
+    bool getData_raw(Point3D*& center, Vector3D*& normal, Vector3D*& referenceVector, double& radius, double& startAngle, double& endAngle) const override
+    {
+        center = newPoint(m_center);
+        normal = newVector(m_normal);
+        referenceVector = newVector(m_reference);
+        radius = m_radius;
+        startAngle = m_startAngle;
+        endAngle = m_endAngle;
+        return true;
+    }
+
+    bool set_raw(Point3D* center, Vector3D* normal, Vector3D* referenceVector, double radius, double startAngle, double endAngle) override
+    {
+        if (!center || !normal || !referenceVector || !(radius > 0.0))
+            return false;
+        Vec3 n = valueOf(normal);
+        Vec3 r = valueOf(referenceVector);
+        if (!makeAxes(n, r))
+            return false;
+        m_center = valueOf(center);
+        m_normal = n;
+        m_reference = r;
+        m_radius = radius;
+        m_startAngle = startAngle;
+        m_endAngle = endAngle;
+        return true;
+    }
+
+    // Builds the exact rational quadratic representation, using one segment for each quarter turn
+    // or less of the sweep (The NURBS Book, A7.1). The knots are the angles between segments.
+    NurbsCurve3D* asNurbsCurve_raw() const override
+    {
+        double sweep = m_endAngle - m_startAngle;
+        if (!(sweep > 0.0))
+            return nullptr;
+        int segments = static_cast<int>(std::ceil(sweep / (0.5 * pi) - 1.0e-12));
+        if (segments < 1)
+            segments = 1;
+        double step = sweep / segments;
+        double middleWeight = std::cos(0.5 * step);
+
+        NurbsData data;
+        data.degree = 2;
+        data.isPeriodic = false;
+        data.knots.assign(3, m_startAngle);
+        data.controlPoints.push_back(pointAt(m_startAngle));
+        data.weights.push_back(1.0);
+        for (int i = 0; i < segments; ++i)
+        {
+            double angle = m_startAngle + step * i;
+            Vec3 middle = pointAt(angle + 0.5 * step) - m_center;
+            data.controlPoints.push_back(m_center + middle * (1.0 / middleWeight));
+            data.weights.push_back(middleWeight);
+            double next = i + 1 == segments ? m_endAngle : angle + step;
+            data.controlPoints.push_back(pointAt(next));
+            data.weights.push_back(1.0);
+            data.knots.push_back(next);
+            data.knots.push_back(next);
+        }
+        data.knots.push_back(m_endAngle);
+        return newNurbsCurve(data);
+    }
+
+    Vec3 m_center;
+    Vec3 m_normal;
+    Vec3 m_reference;
+    double m_radius;
+    double m_startAngle;
+    double m_endAngle;
+};
+
+}// namespace headless
+
+inline const char* Arc3D::classType() { return "adsk::core::Arc3D"; }
+inline const char* Arc3D::objectType() const { return classType(); }
+
+inline void* Arc3D::queryInterface(const char* id) const
+{
+    if (isInterface(id, Arc3D::classType()))
+        return const_cast<Arc3D*>(this);
+    return Curve3D::queryInterface(id);
+}
+
+inline Arc3D* Arc3D::createByCenter_raw(Point3D* center, Vector3D* normal, Vector3D* referenceVector, double radius, double startAngle, double endAngle)
+{
+    if (!center || !normal || !referenceVector || !(radius > 0.0))
+        return nullptr;
+    headless::Vec3 n = headless::valueOf(normal);
+    headless::Vec3 r = headless::valueOf(referenceVector);
+    if (!headless::Arc3DImpl::makeAxes(n, r))
+        return nullptr;
+    return new headless::Arc3DImpl(headless::valueOf(center), n, r, radius, startAngle, endAngle);
+}
+
+// The arc starts at the first point and passes through the second to end at the third, so the
+// normal is chosen to make that direction counterclockwise.
+inline Arc3D* Arc3D::createByThreePoints_raw(Point3D* pointOne, Point3D* pointTwo, Point3D* pointThree)
+{
+    using namespace headless;
+    if (!pointOne || !pointTwo || !pointThree)
+        return nullptr;
+    Vec3 p1 = valueOf(pointOne);
+    Vec3 p2 = valueOf(pointTwo);
+    Vec3 p3 = valueOf(pointThree);
+    Vec3 a = p1 - p3;
+    Vec3 b = p2 - p3;
+    Vec3 axb = cross(a, b);
+    double denominator = 2.0 * dot(axb, axb);
+    if (denominator <= pointTolerance * pointTolerance * pointTolerance * pointTolerance)
+        return nullptr;
+    Vec3 center = p3 + cross(b * dot(a, a) - a * dot(b, b), axb) * (1.0 / denominator);
+
+    Vec3 normal = cross(p2 - p1, p3 - p1);
+    Vec3 reference = p1 - center;
+    double radius = length(reference);
+    if (!normalize(normal) || !normalize(reference))
+        return nullptr;
+    Vec3 yAxis = cross(normal, reference);
+    Vec3 offset = p3 - center;
+    double endAngle = std::atan2(dot(offset, yAxis), dot(offset, reference));
+    if (endAngle <= 0.0)
+        endAngle += 2.0 * pi;
+    return new Arc3DImpl(center, normal, reference, radius, 0.0, endAngle);
+}
+
+}// namespace core
+}// namespace adsk
@@ -0,0 +1,117 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/BoundingBox3D.h>
+#include "Point3DImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+class BoundingBox3DImpl : public BoundingBox3D {
+public:
+    BoundingBox3DImpl(const Vec3& minPoint, const Vec3& maxPoint) : m_min(minPoint), m_max(maxPoint) {}
+
+private:
+    Point3D* minPoint_raw() const override { return newPoint(m_min); }
+
+    bool minPoint_raw(Point3D* value) override
+    {
+        if (!value)
+            return false;
+        m_min = valueOf(value);
+        return true;
+    }
+
+    Point3D* maxPoint_raw() const override { return newPoint(m_max); }
+
+    bool maxPoint_raw(Point3D* value) override
+    {
+        if (!value)
+            return false;
+        m_max = valueOf(value);
+        return true;
+    }
+
+    // Points on the boundary are contained by the box.
+    bool contains_raw(Point3D* point) const override
+    {
+        if (!point)
+            return false;
+        Vec3 p = valueOf(point);
+        return p.x >= m_min.x - pointTolerance && p.x <= m_max.x + pointTolerance &&
+               p.y >= m_min.y - pointTolerance && p.y <= m_max.y + pointTolerance &&
+               p.z >= m_min.z - pointTolerance && p.z <= m_max.z + pointTolerance;
+    }
+
+    bool expand_raw(Point3D* point) override
+    {
+        if (!point)
+            return false;
+        include(valueOf(point));
+        return true;
+    }
+
+    bool intersects_raw(BoundingBox3D* boundingBox) const override
+    {
+        if (!boundingBox)
+            return false;
+        Vec3 otherMin = valueOf(boundingBox->minPoint().get());
+        Vec3 otherMax = valueOf(boundingBox->maxPoint().get());
+        return otherMin.x <= m_max.x + pointTolerance && otherMax.x >= m_min.x - pointTolerance &&
+               otherMin.y <= m_max.y + pointTolerance && otherMax.y >= m_min.y - pointTolerance &&
+               otherMin.z <= m_max.z + pointTolerance && otherMax.z >= m_min.z - pointTolerance;
+    }
+
+    BoundingBox3D* copy_raw() const override { return new BoundingBox3DImpl(m_min, m_max); }
+
+    bool combine_raw(BoundingBox3D* boundingBox) override
+    {
+        if (!boundingBox)
+            return false;
+        include(valueOf(boundingBox->minPoint().get()));
+        include(valueOf(boundingBox->maxPoint().get()));
+        return true;
+    }
+
+    void include(const Vec3& p)
+    {
+        m_min = vec3(std::fmin(m_min.x, p.x), std::fmin(m_min.y, p.y), std::fmin(m_min.z, p.z));
+        m_max = vec3(std::fmax(m_max.x, p.x), std::fmax(m_max.y, p.y), std::fmax(m_max.z, p.z));
+    }
+
+    Vec3 m_min;
+    Vec3 m_max;
+};
+
+}// namespace headless
+
+inline const char* BoundingBox3D::classType() { return "adsk::core::BoundingBox3D"; }
+inline const char* BoundingBox3D::objectType() const { return classType(); }
+
+inline void* BoundingBox3D::queryInterface(const char* id) const
+{
+    if (isInterface(id, BoundingBox3D::classType()))
+        return const_cast<BoundingBox3D*>(this);
+    if (isInterface(id, Base::classType()))
+        return static_cast<Base*>(const_cast<BoundingBox3D*>(this));
+    return nullptr;
+}
+
+inline BoundingBox3D* BoundingBox3D::create_raw(Point3D* minPoint, Point3D* maxPoint)
+{
+    if (!minPoint || !maxPoint)
+        return nullptr;
+    return new headless::BoundingBox3DImpl(headless::valueOf(minPoint), headless::valueOf(maxPoint));
+}
+
+}// namespace core
+}// namespace adsk
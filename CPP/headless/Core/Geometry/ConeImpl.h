@@ -0,0 +1,133 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/Cone.h>
+#include "SurfaceImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// Cone that holds only its defining data. It has no SurfaceEvaluator, so evaluator returns null;
+/// AnalyticSurfaceEvaluator evaluates it from its data. The half angle must be between 0 and pi/2.
+class ConeImpl : public Cone {
+public:
+    ConeImpl(const Vec3& origin, const Vec3& axis, double radius, double halfAngle)
+        : m_origin(origin), m_axis(axis), m_radius(radius), m_halfAngle(halfAngle)
+    {}
+
+    static bool isValidHalfAngle(double value) { return value > 0.0 && value < 0.5 * pi; }
+
+private:
+    SurfaceTypes surfaceType_raw() const override { return ConeSurfaceType; }
+    SurfaceEvaluator* evaluator_raw() const override { return nullptr; }
+
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        double scale = 1.0;
+        if (!transformPlacement(matrix, m_origin, m_axis, nullptr, scale))
+            return false;
+        m_radius *= scale;
+        return true;
+    }
+
+    Point3D* origin_raw() const override { return newPoint(m_origin); }
+
+    bool origin_raw(Point3D* value) override
+    {
+        if (!value)
+            return false;
+        m_origin = valueOf(value);
+        return true;
+    }
+
+    Vector3D* axis_raw() const override { return newVector(m_axis); }
+
+    bool axis_raw(Vector3D* value) override
+    {
+        Vec3 axis = valueOf(value);
+        if (!value || !makeSurfaceAxes(axis))
+            return false;
+        m_axis = axis;
+        return true;
+    }
+
+    double radius_raw() const override { return m_radius; }
+
+    bool radius_raw(double value) override
+    {
+        if (!(value > 0.0))
+            return false;
+        m_radius = value;
+        return true;
+    }
+
+    double halfAngle_raw() const override { return m_halfAngle; }
+
+    bool halfAngle_raw(double value) override
+    {
+        if (!isValidHalfAngle(value))
+            return false;
+        m_halfAngle = value;
+        return true;
+    }
+
+    bool getData_raw(Point3D*& origin, Vector3D*& axis, double& radius, double& halfAngle) const override
+    {
+        origin = newPoint(m_origin);
+        axis = newVector(m_axis);
+        radius = m_radius;
+        halfAngle = m_halfAngle;
+        return true;
+    }
+
+    bool set_raw(Point3D* origin, Vector3D* axis, double radius, double halfAngle) override
+    {
+        Vec3 a = valueOf(axis);
+        if (!origin || !axis || !makeSurfaceAxes(a) || !(radius > 0.0) || !isValidHalfAngle(halfAngle))
+            return false;
+        m_origin = valueOf(origin);
+        m_axis = a;
+        m_radius = radius;
+        m_halfAngle = halfAngle;
+        return true;
+    }
+
+    Cone* copy_raw() const override { return new ConeImpl(m_origin, m_axis, m_radius, m_halfAngle); }
+
+    Vec3 m_origin;
+    Vec3 m_axis;
+    double m_radius;
+    double m_halfAngle;
+};
+
+}// namespace headless
+
+inline const char* Cone::classType() { return "adsk::core::Cone"; }
+inline const char* Cone::objectType() const { return classType(); }
+
+inline void* Cone::queryInterface(const char* id) const
+{
+    if (isInterface(id, Cone::classType()))
+        return const_cast<Cone*>(this);
+    return Surface::queryInterface(id);
+}
+
+inline Cone* Cone::create_raw(Point3D* origin, Vector3D* axis, double radius, double halfAngle)
+{
+    headless::Vec3 a = headless::valueOf(axis);
+    if (!origin || !axis || !headless::makeSurfaceAxes(a) || !(radius > 0.0) || !headless::ConeImpl::isValidHalfAngle(halfAngle))
+        return nullptr;
+    return new headless::ConeImpl(headless::valueOf(origin), a, radius, halfAngle);
+}
+
+}// namespace core
+}// namespace adsk
@@ -0,0 +1,497 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/Curve3D.h>
+#include <Core/Geometry/CurveEvaluator3D.h>
+#include "Point3DImpl.h"
+#include <algorithm>
+#include <vector>
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// The parametric definition of a curve, implemented by each of the headless curve types and used
+/// by CurveEvaluator3DImpl to answer every evaluator query.
+class CurveGeometry {
+public:
+    virtual ~CurveGeometry() {}
+
+    /// Gets the parameter range of the curve.
+    virtual void extents(double& startParameter, double& endParameter) const = 0;
+
+    /// Evaluates the curve and its derivatives at a parameter.
+    /// order : The highest derivative to compute, from 0 to 3.
+    /// values : Receives the point followed by order derivatives.
+    virtual void evaluate(double parameter, int order, Vec3* values) const = 0;
+
+    /// Gets the parameters, including the extents, between which the curve is smooth. Integration and
+    /// sampling are done separately on each of these spans.
+    virtual void spans(std::vector<double>& parameters) const
+    {
+        parameters.resize(2);
+        extents(parameters[0], parameters[1]);
+    }
+
+    /// Returns the number of samples per span used to find a starting guess for point projection.
+    virtual int samplesPerSpan() const { return 8; }
+
+    Vec3 pointAt(double parameter) const
+    {
+        Vec3 value;
+        evaluate(parameter, 0, &value);
+        return value;
+    }
+
+    Vec3 derivativeAt(double parameter, int order) const
+    {
+        Vec3 values[4];
+        evaluate(parameter, order, values);
+        return values[order];
+    }
+};
+
+/// Evaluator for the headless curves. The evaluator holds a reference to its curve and always
+/// reflects the current shape of the curve.
+///
+/// Parameters must be within the extents of the curve. Points passed to getParameterAtPoint and
+/// getParametersAtPoints don't need to lie on the curve; the parameter of the closest point on the
+/// curve is returned.
+class CurveEvaluator3DImpl : public CurveEvaluator3D {
+public:
+    CurveEvaluator3DImpl(const Curve3D* curve, const CurveGeometry* geometry)
+        : m_curve(const_cast<Curve3D*>(curve), false), m_geometry(geometry)
+    {}
+
+private:
+    bool getCurvatures_raw(const double* parameters, size_t parameters_size, Vector3D**& directions, size_t& directions_size, double*& curvatures, size_t& curvatures_size) const override
+    {
+        if (!areInRange(parameters, parameters_size))
+            return false;
+        directions = new Vector3D*[parameters_size];
+        curvatures = new double[parameters_size];
+        for (size_t i = 0; i < parameters_size; ++i)
+        {
+            Vec3 direction;
+            curvatures[i] = curvature(parameters[i], direction);
+            directions[i] = newVector(direction);
+        }
+        directions_size = parameters_size;
+        curvatures_size = parameters_size;
+        return true;
+    }
+
+    bool getCurvature_raw(double parameter, Vector3D*& direction, double& curvature) const override
+    {
+        if (!isInRange(parameter))
+            return false;
+        Vec3 value;
+        curvature = this->curvature(parameter, value);
+        direction = newVector(value);
+        return true;
+    }
+
+    bool getEndPoints_raw(Point3D*& startPoint, Point3D*& endPoint) const override
+    {
+        double start, end;
+        m_geometry->extents(start, end);
+        startPoint = newPoint(m_geometry->pointAt(start));
+        endPoint = newPoint(m_geometry->pointAt(end));
+        return true;
+    }
+
+    bool getLengthAtParameter_raw(double fromParameter, double toParameter, double& length) const override
+    {
+        if (!isInRange(fromParameter) || !isInRange(toParameter))
+            return false;
+        length = lengthBetween(fromParameter, toParameter);
+        return true;
+    }
+
+    // Solves for the parameter with Newton's method, keeping a bracket so the iteration always
+    // converges. A negative length measures backwards from fromParameter.
+    bool getParameterAtLength_raw(double fromParameter, double length, double& parameter) const override
+    {
+        if (!isInRange(fromParameter))
+            return false;
+        double start, end;
+        m_geometry->extents(start, end);
+        double limit = length >= 0.0 ? end : start;
+        double total = lengthBetween(fromParameter, limit);
+        if (std::fabs(length) > std::fabs(total) + pointTolerance)
+            return false;
+
+        double low = std::min(fromParameter, limit);
+        double high = std::max(fromParameter, limit);
+        double t = std::fabs(total) > 0.0 ? fromParameter + (limit - fromParameter) * (length / total) : fromParameter;
+        for (int iteration = 0; iteration < 100; ++iteration)
+        {
+            double error = lengthBetween(fromParameter, t) - length;
+            if (std::fabs(error) <= pointTolerance * 1.0e-2)
+                break;
+            if (error > 0.0)
+                high = t;
+            else
+                low = t;
+            double speed = headless::length(m_geometry->derivativeAt(t, 1));
+            double next = speed > 0.0 ? t - error / speed : 0.5 * (low + high);
+            if (next <= low || next >= high)
+                next = 0.5 * (low + high);
+            if (std::fabs(next - t) <= 1.0e-15 * std::max(1.0, std::fabs(t)))
+            {
+                t = next;
+                break;
+            }
+            t = next;
+        }
+        parameter = t;
+        return true;
+    }
+
+    bool getParametersAtPoints_raw(Point3D** points, size_t points_size, double*& parameters, size_t& parameters_size) const override
+    {
+        if (!points && points_size > 0)
+            return false;
+        parameters = new double[points_size];
+        for (size_t i = 0; i < points_size; ++i)
+            parameters[i] = closestParameter(valueOf(points[i]));
+        parameters_size = points_size;
+        return true;
+    }
+
+    bool getParameterAtPoint_raw(Point3D* point, double& parameter) const override
+    {
+        if (!point)
+            return false;
+        parameter = closestParameter(valueOf(point));
+        return true;
+    }
+
+    bool getParameterExtents_raw(double& startParameter, double& endParameter) const override
+    {
+        m_geometry->extents(startParameter, endParameter);
+        return true;
+    }
+
+    bool getPointsAtParameters_raw(const double* parameters, size_t parameters_size, Point3D**& points, size_t& points_size) const override
+    {
+        return derivativesAt(parameters, parameters_size, 0, points, points_size);
+    }
+
+    bool getPointAtParameter_raw(double parameter, Point3D*& point) const override
+    {
+        if (!isInRange(parameter))
+            return false;
+        point = newPoint(m_geometry->pointAt(parameter));
+        return true;
+    }
+
+    bool getFirstDerivatives_raw(const double* parameters, size_t parameters_size, Vector3D**& firstDerivatives, size_t& firstDerivatives_size) const override
+    {
+        return derivativesAt(parameters, parameters_size, 1, firstDerivatives, firstDerivatives_size);
+    }
+
+    bool getFirstDerivative_raw(double parameter, Vector3D*& firstDerivative) const override
+    {
+        return derivativeAt(parameter, 1, firstDerivative);
+    }
+
+    bool getSecondDerivatives_raw(const double* parameters, size_t parameters_size, Vector3D**& secondDerivatives, size_t& secondDerivatives_size) const override
+    {
+        return derivativesAt(parameters, parameters_size, 2, secondDerivatives, secondDerivatives_size);
+    }
+
+    bool getSecondDerivative_raw(double parameter, Vector3D*& secondDerivative) const override
+    {
+        return derivativeAt(parameter, 2, secondDerivative);
+    }
+
+    bool getThirdDerivatives_raw(const double* parameters, size_t parameters_size, Vector3D**& thirdDerivatives, size_t& thirdDerivatives_size) const override
+    {
+        return derivativesAt(parameters, parameters_size, 3, thirdDerivatives, thirdDerivatives_size);
+    }
+
+    bool getThirdDerivative_raw(double parameter, Vector3D*& thirdDerivative) const override
+    {
+        return derivativeAt(parameter, 3, thirdDerivative);
+    }
+
+    // Each span of the curve is split into four and then subdivided until the midpoint of every
+    // segment is within the tolerance of the chord.
+    bool getStrokes_raw(double fromParameter, double toParameter, double tolerance, Point3D**& vertexCoordinates, size_t& vertexCoordinates_size) const override
+    {
+        if (!isInRange(fromParameter) || !isInRange(toParameter) || tolerance <= 0.0)
+            return false;
+        std::vector<double> breaks;
+        m_geometry->spans(breaks);
+        double low = std::min(fromParameter, toParameter);
+        double high = std::max(fromParameter, toParameter);
+
+        std::vector<double> parameters;
+        parameters.push_back(low);
+        for (size_t i = 0; i < breaks.size(); ++i)
+        {
+            if (breaks[i] > low && breaks[i] < high)
+                parameters.push_back(breaks[i]);
+        }
+        parameters.push_back(high);
+
+        std::vector<Vec3> vertices;
+        vertices.push_back(m_geometry->pointAt(low));
+        for (size_t i = 0; i + 1 < parameters.size(); ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                double t0 = parameters[i] + (parameters[i + 1] - parameters[i]) * j / 4.0;
+                double t1 = parameters[i] + (parameters[i + 1] - parameters[i]) * (j + 1) / 4.0;
+                stroke(t0, m_geometry->pointAt(t0), t1, m_geometry->pointAt(t1), tolerance, 0, vertices);
+            }
+        }
+        if (toParameter < fromParameter)
+            std::reverse(vertices.begin(), vertices.end());
+
+        vertexCoordinates = new Point3D*[vertices.size()];
+        for (size_t i = 0; i < vertices.size(); ++i)
+            vertexCoordinates[i] = newPoint(vertices[i]);
+        vertexCoordinates_size = vertices.size();
+        return true;
+    }
+
+    bool getTangents_raw(const double* parameters, size_t parameters_size, Vector3D**& tangents, size_t& tangents_size) const override
+    {
+        if (!areInRange(parameters, parameters_size))
+            return false;
+        tangents = new Vector3D*[parameters_size];
+        for (size_t i = 0; i < parameters_size; ++i)
+            tangents[i] = newVector(tangentAt(parameters[i]));
+        tangents_size = parameters_size;
+        return true;
+    }
+
+    bool getTangent_raw(double parameter, Vector3D*& tangent) const override
+    {
+        if (!isInRange(parameter))
+            return false;
+        tangent = newVector(tangentAt(parameter));
+        return true;
+    }
+
+    bool getPointsAtParametersFlat_raw(const double* parameters, size_t count, double* points) const override
+    {
+        if (!areInRange(parameters, count) || (!points && count > 0))
+            return false;
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vec3 p = m_geometry->pointAt(parameters[i]);
+            points[3 * i] = p.x;
+            points[3 * i + 1] = p.y;
+            points[3 * i + 2] = p.z;
+        }
+        return true;
+    }
+
+    bool isInRange(double parameter) const
+    {
+        double start, end;
+        m_geometry->extents(start, end);
+        double tolerance = 1.0e-10 * std::max(1.0, std::fabs(end - start));
+        return parameter >= start - tolerance && parameter <= end + tolerance;
+    }
+
+    bool areInRange(const double* parameters, size_t parameters_size) const
+    {
+        if (!parameters && parameters_size > 0)
+            return false;
+        for (size_t i = 0; i < parameters_size; ++i)
+        {
+            if (!isInRange(parameters[i]))
+                return false;
+        }
+        return true;
+    }
+
+    template <class T>
+    bool derivativesAt(const double* parameters, size_t parameters_size, int order, T**& values, size_t& values_size) const
+    {
+        if (!areInRange(parameters, parameters_size))
+            return false;
+        values = new T*[parameters_size];
+        for (size_t i = 0; i < parameters_size; ++i)
+            values[i] = newValue(m_geometry->derivativeAt(parameters[i], order), static_cast<T*>(nullptr));
+        values_size = parameters_size;
+        return true;
+    }
+
+    bool derivativeAt(double parameter, int order, Vector3D*& value) const
+    {
+        if (!isInRange(parameter))
+            return false;
+        value = newVector(m_geometry->derivativeAt(parameter, order));
+        return true;
+    }
+
+    static Point3D* newValue(const Vec3& value, Point3D*) { return newPoint(value); }
+    static Vector3D* newValue(const Vec3& value, Vector3D*) { return newVector(value); }
+
+    Vec3 tangentAt(double parameter) const
+    {
+        Vec3 tangent = m_geometry->derivativeAt(parameter, 1);
+        normalize(tangent);
+        return tangent;
+    }
+
+    // Returns the curvature and the unit vector pointing towards the center of curvature, which is
+    // the zero vector where the curve is straight.
+    double curvature(double parameter, Vec3& direction) const
+    {
+        Vec3 values[3];
+        m_geometry->evaluate(parameter, 2, values);
+        double speed = length(values[1]);
+        direction = vec3(0.0, 0.0, 0.0);
+        if (speed <= 0.0)
+            return 0.0;
+        Vec3 tangent = values[1] * (1.0 / speed);
+        double res = length(cross(values[1], values[2])) / (speed * speed * speed);
+        Vec3 normal = values[2] - tangent * dot(values[2], tangent);
+        if (res > 0.0 && normalize(normal))
+            direction = normal;
+        return res;
+    }
+
+    struct Speed
+    {
+        const CurveGeometry* geometry;
+        double operator()(double parameter) const { return length(geometry->derivativeAt(parameter, 1)); }
+    };
+
+    // Returns the signed arc length between two parameters, integrating each smooth span separately.
+    double lengthBetween(double fromParameter, double toParameter) const
+    {
+        if (fromParameter == toParameter)
+            return 0.0;
+        double sign = 1.0;
+        if (toParameter < fromParameter)
+        {
+            std::swap(fromParameter, toParameter);
+            sign = -1.0;
+        }
+        std::vector<double> breaks;
+        m_geometry->spans(breaks);
+        Speed speed = { m_geometry };
+        double res = 0.0;
+        double t = fromParameter;
+        for (size_t i = 0; i < breaks.size(); ++i)
+        {
+            if (breaks[i] > t && breaks[i] < toParameter)
+            {
+                res += integrate(speed, t, breaks[i]);
+                t = breaks[i];
+            }
+        }
+        res += integrate(speed, t, toParameter);
+        return sign * res;
+    }
+
+    // Samples every span to find the nearest sample and then refines it with Newton's method on
+    // the derivative of the squared distance.
+    double closestParameter(const Vec3& point) const
+    {
+        double start, end;
+        m_geometry->extents(start, end);
+        std::vector<double> breaks;
+        m_geometry->spans(breaks);
+        int samples = m_geometry->samplesPerSpan();
+
+        double best = start;
+        double bestDistance = length(m_geometry->pointAt(start) - point);
+        for (size_t i = 0; i + 1 < breaks.size(); ++i)
+        {
+            for (int j = 1; j <= samples; ++j)
+            {
+                double t = breaks[i] + (breaks[i + 1] - breaks[i]) * j / samples;
+                double distance = length(m_geometry->pointAt(t) - point);
+                if (distance < bestDistance)
+                {
+                    best = t;
+                    bestDistance = distance;
+                }
+            }
+        }
+
+        double t = best;
+        for (int iteration = 0; iteration < 50; ++iteration)
+        {
+            Vec3 values[3];
+            m_geometry->evaluate(t, 2, values);
+            Vec3 offset = values[0] - point;
+            double f = dot(offset, values[1]);
+            double df = dot(values[1], values[1]) + dot(offset, values[2]);
+            if (df <= 0.0)
+                break;
+            double next = std::min(end, std::max(start, t - f / df));
+            if (std::fabs(next - t) <= 1.0e-15 * std::max(1.0, std::fabs(t)))
+            {
+                t = next;
+                break;
+            }
+            t = next;
+        }
+        return t;
+    }
+
+    void stroke(double t0, const Vec3& p0, double t1, const Vec3& p1, double tolerance, int depth, std::vector<Vec3>& vertices) const
+    {
+        double tm = 0.5 * (t0 + t1);
+        Vec3 pm = m_geometry->pointAt(tm);
+        Vec3 chord = p1 - p0;
+        double chordLength = length(chord);
+        double deviation = chordLength > 0.0 ? length(cross(pm - p0, chord)) / chordLength : length(pm - p0);
+        if (depth < 24 && deviation > tolerance)
+        {
+            stroke(t0, p0, tm, pm, tolerance, depth + 1, vertices);
+            stroke(tm, pm, t1, p1, tolerance, depth + 1, vertices);
+            return;
+        }
+        vertices.push_back(p1);
+    }
+
+    Ptr<Curve3D> m_curve;
+    const CurveGeometry* m_geometry;
+};
+
+}// namespace headless
+
+inline const char* Curve3D::classType() { return "adsk::core::Curve3D"; }
+inline const char* Curve3D::objectType() const { return classType(); }
+
+inline void* Curve3D::queryInterface(const char* id) const
+{
+    if (isInterface(id, Curve3D::classType()))
+        return const_cast<Curve3D*>(this);
+    if (isInterface(id, Base::classType()))
+        return static_cast<Base*>(const_cast<Curve3D*>(this));
+    return nullptr;
+}
+
+inline const char* CurveEvaluator3D::classType() { return "adsk::core::CurveEvaluator3D"; }
+inline const char* CurveEvaluator3D::objectType() const { return classType(); }
+
+inline void* CurveEvaluator3D::queryInterface(const char* id) const
+{
+    if (isInterface(id, CurveEvaluator3D::classType()))
+        return const_cast<CurveEvaluator3D*>(this);
+    if (isInterface(id, Base::classType()))
+        return static_cast<Base*>(const_cast<CurveEvaluator3D*>(this));
+    return nullptr;
+}
+
+}// namespace core
+}// namespace adsk
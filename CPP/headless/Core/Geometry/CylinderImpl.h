@@ -0,0 +1,116 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/Cylinder.h>
+#include "SurfaceImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// Infinite cylinder that holds only its defining data. It has no SurfaceEvaluator, so evaluator
+/// returns null; AnalyticSurfaceEvaluator evaluates it from its data.
+class CylinderImpl : public Cylinder {
+public:
+    CylinderImpl(const Vec3& origin, const Vec3& axis, double radius) : m_origin(origin), m_axis(axis), m_radius(radius) {}
+
+private:
+    SurfaceTypes surfaceType_raw() const override { return CylinderSurfaceType; }
+    SurfaceEvaluator* evaluator_raw() const override { return nullptr; }
+
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        double scale = 1.0;
+        if (!transformPlacement(matrix, m_origin, m_axis, nullptr, scale))
+            return false;
+        m_radius *= scale;
+        return true;
+    }
+
+    Point3D* origin_raw() const override { return newPoint(m_origin); }
+
+    bool origin_raw(Point3D* value) override
+    {
+        if (!value)
+            return false;
+        m_origin = valueOf(value);
+        return true;
+    }
+
+    Vector3D* axis_raw() const override { return newVector(m_axis); }
+
+    bool axis_raw(Vector3D* value) override
+    {
+        Vec3 axis = valueOf(value);
+        if (!value || !makeSurfaceAxes(axis))
+            return false;
+        m_axis = axis;
+        return true;
+    }
+
+    double radius_raw() const override { return m_radius; }
+
+    bool radius_raw(double value) override
+    {
+        if (!(value > 0.0))
+            return false;
+        m_radius = value;
+        return true;
+    }
+
+    bool getData_raw(Point3D*& origin, Vector3D*& axis, double& radius) const override
+    {
+        origin = newPoint(m_origin);
+        axis = newVector(m_axis);
+        radius = m_radius;
+        return true;
+    }
+
+    bool set_raw(Point3D* origin, Vector3D* axis, double radius) override
+    {
+        Vec3 a = valueOf(axis);
+        if (!origin || !axis || !makeSurfaceAxes(a) || !(radius > 0.0))
+            return false;
+        m_origin = valueOf(origin);
+        m_axis = a;
+        m_radius = radius;
+        return true;
+    }
+
+    Cylinder* copy_raw() const override { return new CylinderImpl(m_origin, m_axis, m_radius); }
+
+    Vec3 m_origin;
+    Vec3 m_axis;
+    double m_radius;
+};
+
+}// namespace headless
+
+inline const char* Cylinder::classType() { return "adsk::core::Cylinder"; }
+inline const char* Cylinder::objectType() const { return classType(); }
+
+inline void* Cylinder::queryInterface(const char* id) const
+{
+    if (isInterface(id, Cylinder::classType()))
+        return const_cast<Cylinder*>(this);
+    return Surface::queryInterface(id);
+}
+
+inline Cylinder* Cylinder::create_raw(Point3D* origin, Vector3D* axis, double radius)
+{
+    headless::Vec3 a = headless::valueOf(axis);
+    if (!origin || !axis || !headless::makeSurfaceAxes(a) || !(radius > 0.0))
+        return nullptr;
+    return new headless::CylinderImpl(headless::valueOf(origin), a, radius);
+}
+
+}// namespace core
+}// namespace adsk
@@ -0,0 +1,164 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/EllipticalCone.h>
+#include "ConeImpl.h"
+#include "EllipticalCylinderImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// Elliptical cone that holds only its defining data. It has no SurfaceEvaluator, so evaluator
+/// returns null; AnalyticSurfaceEvaluator evaluates it from its data. The major axis direction must
+/// be perpendicular to the axis, the minor radius can't be larger than the major radius and the
+/// half angle, which is the taper along the major axis, must be between 0 and pi/2.
+class EllipticalConeImpl : public EllipticalCone {
+public:
+    EllipticalConeImpl(const Vec3& origin, const Vec3& axis, const Vec3& majorAxis, double majorRadius, double minorRadius, double halfAngle)
+        : m_origin(origin), m_axis(axis), m_majorAxis(majorAxis), m_majorRadius(majorRadius), m_minorRadius(minorRadius), m_halfAngle(halfAngle)
+    {}
+
+private:
+    SurfaceTypes surfaceType_raw() const override { return EllipticalConeSurfaceType; }
+    SurfaceEvaluator* evaluator_raw() const override { return nullptr; }
+
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        double scale = 1.0;
+        if (!transformPlacement(matrix, m_origin, m_axis, &m_majorAxis, scale))
+            return false;
+        m_majorRadius *= scale;
+        m_minorRadius *= scale;
+        return true;
+    }
+
+    Point3D* origin_raw() const override { return newPoint(m_origin); }
+
+    bool origin_raw(Point3D* value) override
+    {
+        if (!value)
+            return false;
+        m_origin = valueOf(value);
+        return true;
+    }
+
+    void getAxes_raw(Vector3D*& axis, Vector3D*& majorAxisDirection) override
+    {
+        axis = newVector(m_axis);
+        majorAxisDirection = newVector(m_majorAxis);
+    }
+
+    bool setAxes_raw(Vector3D* axis, Vector3D* majorAxisDirection) override
+    {
+        Vec3 a = valueOf(axis);
+        Vec3 m = valueOf(majorAxisDirection);
+        if (!axis || !majorAxisDirection || !makeSurfaceAxes(a, &m))
+            return false;
+        m_axis = a;
+        m_majorAxis = m;
+        return true;
+    }
+
+    double majorRadius_raw() const override { return m_majorRadius; }
+
+    bool majorRadius_raw(double value) override
+    {
+        if (!EllipticalCylinderImpl::isValidRadii(value, m_minorRadius))
+            return false;
+        m_majorRadius = value;
+        return true;
+    }
+
+    double minorRadius_raw() const override { return m_minorRadius; }
+
+    bool minorRadius_raw(double value) override
+    {
+        if (!EllipticalCylinderImpl::isValidRadii(m_majorRadius, value))
+            return false;
+        m_minorRadius = value;
+        return true;
+    }
+
+    double halfAngle_raw() const override { return m_halfAngle; }
+
+    bool halfAngle_raw(double value) override
+    {
+        if (!ConeImpl::isValidHalfAngle(value))
+            return false;
+        m_halfAngle = value;
+        return true;
+    }
+
+    bool getData_raw(Point3D*& origin, Vector3D*& axis, Vector3D*& majorAxisDirection, double& majorRadius, double& minorRadius, double& halfAngle) const override
+    {
+        origin = newPoint(m_origin);
+        axis = newVector(m_axis);
+        majorAxisDirection = newVector(m_majorAxis);
+        majorRadius = m_majorRadius;
+        minorRadius = m_minorRadius;
+        halfAngle = m_halfAngle;
+        return true;
+    }
+
+    bool set_raw(Point3D* origin, Vector3D* axis, Vector3D* majorAxisDirection, double majorRadius, double minorRadius, double halfAngle) override
+    {
+        Vec3 a = valueOf(axis);
+        Vec3 m = valueOf(majorAxisDirection);
+        if (!origin || !axis || !majorAxisDirection || !makeSurfaceAxes(a, &m) ||
+            !EllipticalCylinderImpl::isValidRadii(majorRadius, minorRadius) || !ConeImpl::isValidHalfAngle(halfAngle))
+            return false;
+        m_origin = valueOf(origin);
+        m_axis = a;
+        m_majorAxis = m;
+        m_majorRadius = majorRadius;
+        m_minorRadius = minorRadius;
+        m_halfAngle = halfAngle;
+        return true;
+    }
+
+    EllipticalCone* copy_raw() const override
+    {
+        return new EllipticalConeImpl(m_origin, m_axis, m_majorAxis, m_majorRadius, m_minorRadius, m_halfAngle);
+    }
+
+    Vec3 m_origin;
+    Vec3 m_axis;
+    Vec3 m_majorAxis;
+    double m_majorRadius;
+    double m_minorRadius;
+    double m_halfAngle;
+};
+
+}// namespace headless
+
+inline const char* EllipticalCone::classType() { return "adsk::core::EllipticalCone"; }
+inline const char* EllipticalCone::objectType() const { return classType(); }
+
+inline void* EllipticalCone::queryInterface(const char* id) const
+{
+    if (isInterface(id, EllipticalCone::classType()))
+        return const_cast<EllipticalCone*>(this);
+    return Surface::queryInterface(id);
+}
+
+inline EllipticalCone* EllipticalCone::create_raw(Point3D* origin, Vector3D* axis, Vector3D* majorAxisDirection, double majorRadius, double minorRadius, double halfAngle)
+{
+    headless::Vec3 a = headless::valueOf(axis);
+    headless::Vec3 m = headless::valueOf(majorAxisDirection);
+    if (!origin || !axis || !majorAxisDirection || !headless::makeSurfaceAxes(a, &m) ||
+        !headless::EllipticalCylinderImpl::isValidRadii(majorRadius, minorRadius) || !headless::ConeImpl::isValidHalfAngle(halfAngle))
+        return nullptr;
+    return new headless::EllipticalConeImpl(headless::valueOf(origin), a, m, majorRadius, minorRadius, halfAngle);
+}
+
+}// namespace core
+}// namespace adsk
@@ -0,0 +1,157 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/EllipticalCylinder.h>
+#include "SurfaceImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// Infinite elliptical cylinder that holds only its defining data. It has no SurfaceEvaluator, so
+/// evaluator returns null; AnalyticSurfaceEvaluator evaluates it from its data. The major axis must
+/// be perpendicular to the axis and the minor radius can't be larger than the major radius.
+class EllipticalCylinderImpl : public EllipticalCylinder {
+public:
+    EllipticalCylinderImpl(const Vec3& origin, const Vec3& axis, const Vec3& majorAxis, double majorRadius, double minorRadius)
+        : m_origin(origin), m_axis(axis), m_majorAxis(majorAxis), m_majorRadius(majorRadius), m_minorRadius(minorRadius)
+    {}
+
+    static bool isValidRadii(double majorRadius, double minorRadius) { return minorRadius > 0.0 && minorRadius <= majorRadius; }
+
+private:
+    SurfaceTypes surfaceType_raw() const override { return EllipticalCylinderSurfaceType; }
+    SurfaceEvaluator* evaluator_raw() const override { return nullptr; }
+
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        double scale = 1.0;
+        if (!transformPlacement(matrix, m_origin, m_axis, &m_majorAxis, scale))
+            return false;
+        m_majorRadius *= scale;
+        m_minorRadius *= scale;
+        return true;
+    }
+
+    Point3D* origin_raw() const override { return newPoint(m_origin); }
+
+    bool origin_raw(Point3D* value) override
+    {
+        if (!value)
+            return false;
+        m_origin = valueOf(value);
+        return true;
+    }
+
+    Vector3D* axis_raw() const override { return newVector(m_axis); }
+
+    bool axis_raw(Vector3D* value) override
+    {
+        Vec3 axis = valueOf(value);
+        Vec3 majorAxis = m_majorAxis;
+        if (!value || !makeSurfaceAxes(axis, &majorAxis))
+            return false;
+        m_axis = axis;
+        return true;
+    }
+
+    Vector3D* majorAxis_raw() const override { return newVector(m_majorAxis); }
+
+    bool majorAxis_raw(Vector3D* value) override
+    {
+        Vec3 axis = m_axis;
+        Vec3 majorAxis = valueOf(value);
+        if (!value || !makeSurfaceAxes(axis, &majorAxis))
+            return false;
+        m_majorAxis = majorAxis;
+        return true;
+    }
+
+    double majorRadius_raw() const override { return m_majorRadius; }
+
+    bool majorRadius_raw(double value) override
+    {
+        if (!isValidRadii(value, m_minorRadius))
+            return false;
+        m_majorRadius = value;
+        return true;
+    }
+
+    double minorRadius_raw() const override { return m_minorRadius; }
+
+    bool minorRadius_raw(double value) override
+    {
+        if (!isValidRadii(m_majorRadius, value))
+            return false;
+        m_minorRadius = value;
+        return true;
+    }
+
+    bool getData_raw(Point3D*& origin, Vector3D*& axis, Vector3D*& majorAxis, double& majorRadius, double& minorRadius) const override
+    {
+        origin = newPoint(m_origin);
+        axis = newVector(m_axis);
+        majorAxis = newVector(m_majorAxis);
+        majorRadius = m_majorRadius;
+        minorRadius = m_minorRadius;
+        return true;
+    }
+
+    bool set_raw(Point3D* origin, Vector3D* axis, Vector3D* majorAxis, double majorRadius, double minorRadius) override
+    {
+        Vec3 a = valueOf(axis);
+        Vec3 m = valueOf(majorAxis);
+        if (!origin || !axis || !majorAxis || !makeSurfaceAxes(a, &m) || !isValidRadii(majorRadius, minorRadius))
+            return false;
+        m_origin = valueOf(origin);
+        m_axis = a;
+        m_majorAxis = m;
+        m_majorRadius = majorRadius;
+        m_minorRadius = minorRadius;
+        return true;
+    }
+
+    EllipticalCylinder* copy_raw() const override
+    {
+        return new EllipticalCylinderImpl(m_origin, m_axis, m_majorAxis, m_majorRadius, m_minorRadius);
+    }
+
+    Vec3 m_origin;
+    Vec3 m_axis;
+    Vec3 m_majorAxis;
+    double m_majorRadius;
+    double m_minorRadius;
+};
+
+}// namespace headless
+
+inline const char* EllipticalCylinder::classType() { return "adsk::core::EllipticalCylinder"; }
+inline const char* EllipticalCylinder::objectType() const { return classType(); }
+
+inline void* EllipticalCylinder::queryInterface(const char* id) const
+{
+    if (isInterface(id, EllipticalCylinder::classType()))
+        return const_cast<EllipticalCylinder*>(this);
+    return Surface::queryInterface(id);
+}
+
+inline EllipticalCylinder* EllipticalCylinder::create_raw(Point3D* origin, Vector3D* axis, Vector3D* majorAxis, double majorRadius, double minorRadius)
+{
+    headless::Vec3 a = headless::valueOf(axis);
+    headless::Vec3 m = headless::valueOf(majorAxis);
+    if (!origin || !axis || !majorAxis || !headless::makeSurfaceAxes(a, &m) ||
+        !headless::EllipticalCylinderImpl::isValidRadii(majorRadius, minorRadius))
+        return nullptr;
+    return new headless::EllipticalCylinderImpl(headless::valueOf(origin), a, m, majorRadius, minorRadius);
+}
+
+}// namespace core
+}// namespace adsk
@@ -0,0 +1,53 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Header-only reference implementation of the core 3D geometry types, for building and testing
+// code that uses them without the Fusion host, such as unit tests and benchmarks run in CI.
+//
+// The implementation provides the classes the host normally exports from its libraries, together
+// with stand-ins for Base.h and OSMacros.h. Compile with the headless directories ahead of the SDK
+// so they take the place of the host headers:
+//
+//     -I CPP/include -I CPP/headless/Core -I CPP/headless/Core/Geometry
+//
+// and include this header in every translation unit that uses the geometry types. It includes the
+// SDK headers of the implemented types; CoreAll.h can't be used because it needs the Utils.h that
+// ships with the host.
+//
+//     #include <HeadlessGeometry.h>
+//
+// The tests in CPP/headless/Tests and the benchmarks in CPP/headless/Benchmarks are built this way,
+// with the command given at the top of each source file.
+//
+// The implemented types are Point3D, Vector3D, Matrix3D, BoundingBox3D, Line3D, Arc3D and
+// NurbsCurve3D, along with the evaluators of their curves. The results match the host to within
+// the modeling tolerance, except where a class notes otherwise. The transient Cylinder, Cone,
+// Sphere, Torus, EllipticalCylinder and EllipticalCone hold their data only, so they can be
+// evaluated with AnalyticSurfaceEvaluator but have no SurfaceEvaluator. The other geometry types
+// are declared but not implemented, so using them fails to link. HeadlessCore.h adds the few
+// application objects that have a headless implementation.
+
+#include "Point3DImpl.h"
+#include "Vector3DImpl.h"
+#include "Matrix3DImpl.h"
+#include "BoundingBox3DImpl.h"
+#include "CurveEvaluator3DImpl.h"
+#include "NurbsCurve3DImpl.h"
+#include "Line3DImpl.h"
+#include "Arc3DImpl.h"
+#include "SurfaceImpl.h"
+#include "CylinderImpl.h"
+#include "ConeImpl.h"
+#include "SphereImpl.h"
+#include "TorusImpl.h"
+#include "EllipticalCylinderImpl.h"
+#include "EllipticalConeImpl.h"
@@ -0,0 +1,267 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <cmath>
+#include <cstddef>
+
+// Numeric helpers shared by the headless geometry implementation.
+
+namespace adsk { namespace core { namespace headless {
+
+/// Distance below which two points are considered equal, in centimeters.
+const double pointTolerance = 1.0e-10;
+
+/// Tolerance used for angular and relative comparisons, such as parallel and perpendicular vectors.
+const double angleTolerance = 1.0e-10;
+
+const double pi = 3.14159265358979323846;
+
+struct Vec3
+{
+    double x, y, z;
+};
+
+inline Vec3 vec3(double x, double y, double z)
+{
+    Vec3 v = { x, y, z };
+    return v;
+}
+
+inline Vec3 operator+(const Vec3& a, const Vec3& b) { return vec3(a.x + b.x, a.y + b.y, a.z + b.z); }
+inline Vec3 operator-(const Vec3& a, const Vec3& b) { return vec3(a.x - b.x, a.y - b.y, a.z - b.z); }
+inline Vec3 operator-(const Vec3& a) { return vec3(-a.x, -a.y, -a.z); }
+inline Vec3 operator*(const Vec3& a, double s) { return vec3(a.x * s, a.y * s, a.z * s); }
+inline Vec3 operator*(double s, const Vec3& a) { return a * s; }
+inline double dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline Vec3 cross(const Vec3& a, const Vec3& b) { return vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x); }
+inline double length(const Vec3& a) { return std::sqrt(dot(a, a)); }
+
+/// Returns the vector scaled to unit length, or false if it has no length.
+inline bool normalize(Vec3& a)
+{
+    double len = length(a);
+    if (len <= pointTolerance)
+        return false;
+    a = a * (1.0 / len);
+    return true;
+}
+
+/// Returns the angle between two vectors in the range 0 to pi. Computed from the sine and cosine
+/// so it stays accurate for nearly parallel vectors.
+inline double angleBetween(const Vec3& a, const Vec3& b)
+{
+    return std::atan2(length(cross(a, b)), dot(a, b));
+}
+
+inline bool isParallel(const Vec3& a, const Vec3& b)
+{
+    double scale = length(a) * length(b);
+    return scale > 0.0 && length(cross(a, b)) <= angleTolerance * scale;
+}
+
+inline bool isPerpendicular(const Vec3& a, const Vec3& b)
+{
+    double scale = length(a) * length(b);
+    return scale > 0.0 && std::fabs(dot(a, b)) <= angleTolerance * scale;
+}
+
+/// Returns a unit vector perpendicular to a unit vector.
+inline Vec3 anyPerpendicular(const Vec3& a)
+{
+    Vec3 axis = std::fabs(a.x) < 0.9 ? vec3(1.0, 0.0, 0.0) : vec3(0.0, 1.0, 0.0);
+    Vec3 res = cross(a, axis);
+    normalize(res);
+    return res;
+}
+
+/// A 4x4 matrix stored by rows, using column vectors so the translation is in the last column.
+struct Mat4
+{
+    double m[16];
+
+    double& operator()(int row, int column) { return m[row * 4 + column]; }
+    double operator()(int row, int column) const { return m[row * 4 + column]; }
+};
+
+inline Mat4 identity()
+{
+    Mat4 res = {};
+    res(0, 0) = res(1, 1) = res(2, 2) = res(3, 3) = 1.0;
+    return res;
+}
+
+inline Mat4 operator*(const Mat4& a, const Mat4& b)
+{
+    Mat4 res;
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+            res(i, j) = a(i, 0) * b(0, j) + a(i, 1) * b(1, j) + a(i, 2) * b(2, j) + a(i, 3) * b(3, j);
+    return res;
+}
+
+inline Vec3 transformPoint(const Mat4& a, const Vec3& p)
+{
+    Vec3 res = vec3(a(0, 0) * p.x + a(0, 1) * p.y + a(0, 2) * p.z + a(0, 3),
+                    a(1, 0) * p.x + a(1, 1) * p.y + a(1, 2) * p.z + a(1, 3),
+                    a(2, 0) * p.x + a(2, 1) * p.y + a(2, 2) * p.z + a(2, 3));
+    double w = a(3, 0) * p.x + a(3, 1) * p.y + a(3, 2) * p.z + a(3, 3);
+    if (w != 1.0 && w != 0.0)
+        res = res * (1.0 / w);
+    return res;
+}
+
+inline Vec3 transformVector(const Mat4& a, const Vec3& v)
+{
+    return vec3(a(0, 0) * v.x + a(0, 1) * v.y + a(0, 2) * v.z,
+                a(1, 0) * v.x + a(1, 1) * v.y + a(1, 2) * v.z,
+                a(2, 0) * v.x + a(2, 1) * v.y + a(2, 2) * v.z);
+}
+
+/// Inverts a matrix using Gauss-Jordan elimination with partial pivoting. Returns false if the
+/// matrix is singular.
+inline bool invert(const Mat4& a, Mat4& inverse)
+{
+    Mat4 work = a;
+    inverse = identity();
+    for (int column = 0; column < 4; ++column)
+    {
+        int pivot = column;
+        for (int row = column + 1; row < 4; ++row)
+        {
+            if (std::fabs(work(row, column)) > std::fabs(work(pivot, column)))
+                pivot = row;
+        }
+        if (std::fabs(work(pivot, column)) < 1.0e-300)
+            return false;
+        if (pivot != column)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                double t = work(column, j); work(column, j) = work(pivot, j); work(pivot, j) = t;
+                t = inverse(column, j); inverse(column, j) = inverse(pivot, j); inverse(pivot, j) = t;
+            }
+        }
+        double scale = 1.0 / work(column, column);
+        for (int j = 0; j < 4; ++j)
+        {
+            work(column, j) *= scale;
+            inverse(column, j) *= scale;
+        }
+        for (int row = 0; row < 4; ++row)
+        {
+            if (row == column)
+                continue;
+            double factor = work(row, column);
+            if (factor == 0.0)
+                continue;
+            for (int j = 0; j < 4; ++j)
+            {
+                work(row, j) -= factor * work(column, j);
+                inverse(row, j) -= factor * inverse(column, j);
+            }
+        }
+    }
+    return true;
+}
+
+inline double determinant(const Mat4& a)
+{
+    // Laplace expansion using 2x2 minors of the first two and last two rows.
+    double s0 = a(0, 0) * a(1, 1) - a(1, 0) * a(0, 1);
+    double s1 = a(0, 0) * a(1, 2) - a(1, 0) * a(0, 2);
+    double s2 = a(0, 0) * a(1, 3) - a(1, 0) * a(0, 3);
+    double s3 = a(0, 1) * a(1, 2) - a(1, 1) * a(0, 2);
+    double s4 = a(0, 1) * a(1, 3) - a(1, 1) * a(0, 3);
+    double s5 = a(0, 2) * a(1, 3) - a(1, 2) * a(0, 3);
+    double c5 = a(2, 2) * a(3, 3) - a(3, 2) * a(2, 3);
+    double c4 = a(2, 1) * a(3, 3) - a(3, 1) * a(2, 3);
+    double c3 = a(2, 1) * a(3, 2) - a(3, 1) * a(2, 2);
+    double c2 = a(2, 0) * a(3, 3) - a(3, 0) * a(2, 3);
+    double c1 = a(2, 0) * a(3, 2) - a(3, 0) * a(2, 2);
+    double c0 = a(2, 0) * a(3, 1) - a(3, 0) * a(2, 1);
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+/// Returns the rotation of angle radians about a unit axis through the origin.
+inline Mat4 rotation(double angle, const Vec3& axis)
+{
+    double c = std::cos(angle);
+    double s = std::sin(angle);
+    double t = 1.0 - c;
+    Mat4 res = identity();
+    res(0, 0) = t * axis.x * axis.x + c;
+    res(0, 1) = t * axis.x * axis.y - s * axis.z;
+    res(0, 2) = t * axis.x * axis.z + s * axis.y;
+    res(1, 0) = t * axis.x * axis.y + s * axis.z;
+    res(1, 1) = t * axis.y * axis.y + c;
+    res(1, 2) = t * axis.y * axis.z - s * axis.x;
+    res(2, 0) = t * axis.x * axis.z - s * axis.y;
+    res(2, 1) = t * axis.y * axis.z + s * axis.x;
+    res(2, 2) = t * axis.z * axis.z + c;
+    return res;
+}
+
+/// Returns the matrix whose columns are the axes and origin of a coordinate system.
+inline Mat4 fromCoordinateSystem(const Vec3& origin, const Vec3& xAxis, const Vec3& yAxis, const Vec3& zAxis)
+{
+    Mat4 res = identity();
+    const Vec3* columns[4] = { &xAxis, &yAxis, &zAxis, &origin };
+    for (int j = 0; j < 4; ++j)
+    {
+        res(0, j) = columns[j]->x;
+        res(1, j) = columns[j]->y;
+        res(2, j) = columns[j]->z;
+    }
+    return res;
+}
+
+/// Integrates a function over an interval using adaptive 7 and 15 point Gauss-Kronrod quadrature.
+/// function : Called with a parameter and returns the value of the integrand.
+template <class Function>
+double integrate(Function& function, double from, double to, double tolerance = 1.0e-13, int depth = 0)
+{
+    static const double nodes[8] = {
+        0.991455371120812639206854697526329, 0.949107912342758524526189684047851,
+        0.864864423359769072789712788640926, 0.741531185599394439863864773280788,
+        0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+        0.207784955007898467600689403773245, 0.000000000000000000000000000000000 };
+    static const double kronrod[8] = {
+        0.022935322010529224963732008058970, 0.063092092629978553290700663189204,
+        0.104790010322250183839876322541518, 0.140653259715525918745189590510238,
+        0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+        0.204432940075298892414161999234649, 0.209482141084727828012999174891714 };
+    static const double gauss[4] = {
+        0.129484966168869693270611432679082, 0.279705391489276667901467771423780,
+        0.381830050505118944950369775488975, 0.417959183673469387755102040816327 };
+
+    double center = 0.5 * (from + to);
+    double half = 0.5 * (to - from);
+    double kronrodSum = kronrod[7] * function(center);
+    double gaussSum = gauss[3] * function(center);
+    for (int i = 0; i < 7; ++i)
+    {
+        double offset = half * nodes[i];
+        double f = function(center - offset) + function(center + offset);
+        kronrodSum += kronrod[i] * f;
+        if (i % 2 == 1)
+            gaussSum += gauss[i / 2] * f;
+    }
+    kronrodSum *= half;
+    gaussSum *= half;
+    double error = std::fabs(kronrodSum - gaussSum);
+    if (depth >= 30 || error <= tolerance * std::fabs(kronrodSum) || error <= 1.0e-300)
+        return kronrodSum;
+    return integrate(function, from, center, tolerance, depth + 1) + integrate(function, center, to, tolerance, depth + 1);
+}
+
+}// namespace headless
+}// namespace core
+}// namespace adsk
@@ -0,0 +1,166 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/Line3D.h>
+#include <Core/Application/ObjectCollection.h>
+#include "NurbsCurve3DImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// Line segment parameterized by the distance from the start point, so the parameter extents are
+/// zero to the length of the line.
+///
+/// Infinite lines, surfaces and curve intersection are not part of the headless implementation;
+/// asInfiniteLine, intersectWithCurve and intersectWithSurface return null.
+class Line3DImpl : public Line3D, public CurveGeometry {
+public:
+    Line3DImpl(const Vec3& startPoint, const Vec3& endPoint) : m_start(startPoint), m_end(endPoint) {}
+
+    void extents(double& startParameter, double& endParameter) const override
+    {
+        startParameter = 0.0;
+        endParameter = length(m_end - m_start);
+    }
+
+    void evaluate(double parameter, int order, Vec3* values) const override
+    {
+        Vec3 direction = m_end - m_start;
+        normalize(direction);
+        values[0] = m_start + direction * parameter;
+        if (order >= 1)
+            values[1] = direction;
+        for (int k = 2; k <= order; ++k)
+            values[k] = vec3(0.0, 0.0, 0.0);
+    }
+
+private:
+    Curve3DTypes curveType_raw() const override { return Line3DCurveType; }
+    CurveEvaluator3D* evaluator_raw() const override { return new CurveEvaluator3DImpl(this, this); }
+
+    // The evaluator holds the only reference to its copy of the curve, so nothing else can change it.
+    CurveEvaluator3D* detachedEvaluator_raw() const override
+    {
+        Line3DImpl* copy = new Line3DImpl(m_start, m_end);
+        CurveEvaluator3D* res = new CurveEvaluator3DImpl(copy, copy);
+        copy->release();
+        return res;
+    }
+
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        if (!matrix)
+            return false;
+        Mat4 m = valueOf(matrix);
+        m_start = transformPoint(m, m_start);
+        m_end = transformPoint(m, m_end);
+        return true;
+    }
+
+    Point3D* startPoint_raw() const override { return newPoint(m_start); }
+
+    bool startPoint_raw(Point3D* value) override
+    {
+        if (!value)
+            return false;
+        m_start = valueOf(value);
+        return true;
+    }
+
+    Point3D* endPoint_raw() const override { return newPoint(m_end); }
+
+    bool endPoint_raw(Point3D* value) override
+    {
+        if (!value)
+            return false;
+        m_end = valueOf(value);
+        return true;
+    }
+
+    Line3D* copy_raw() const override { return new Line3DImpl(m_start, m_end); }
+    InfiniteLine3D* asInfiniteLine_raw() const override { return nullptr; }
+
+    bool isColinearTo_raw(Line3D* line) const override
+    {
+        if (!line)
+            return false;
+        Vec3 direction = m_end - m_start;
+        if (!normalize(direction))
+            return false;
+        Ptr<Point3D> otherStart, otherEnd;
+        line->getData(otherStart, otherEnd);
+        return distanceToLine(valueOf(otherStart.get()), direction) <= pointTolerance &&
+               distanceToLine(valueOf(otherEnd.get()), direction) <= pointTolerance;
+    }
+
+    ObjectCollection* intersectWithCurve_raw(Curve3D* /*curve*/) const override { return nullptr; }
+    ObjectCollection* intersectWithSurface_raw(Surface* /*surface*/) const override { return nullptr; }
+
+    bool getData_raw(Point3D*& startPoint, Point3D*& endPoint) const override
+    {
+        startPoint = newPoint(m_start);
+        endPoint = newPoint(m_end);
+        return true;
+    }
+
+    bool set_raw(Point3D* startPoint, Point3D* endPoint) override
+    {
+        if (!startPoint || !endPoint)
+            return false;
+        m_start = valueOf(startPoint);
+        m_end = valueOf(endPoint);
+        return true;
+    }
+
+    NurbsCurve3D* asNurbsCurve_raw() const override
+    {
+        NurbsData data;
+        data.degree = 1;
+        data.isPeriodic = false;
+        data.controlPoints.push_back(m_start);
+        data.controlPoints.push_back(m_end);
+        double lineLength = length(m_end - m_start);
+        double knots[4] = { 0.0, 0.0, lineLength, lineLength };
+        data.knots.assign(knots, knots + 4);
+        return newNurbsCurve(data);
+    }
+
+    double distanceToLine(const Vec3& point, const Vec3& direction) const
+    {
+        return length(cross(point - m_start, direction));
+    }
+
+    Vec3 m_start;
+    Vec3 m_end;
+};
+
+}// namespace headless
+
+inline const char* Line3D::classType() { return "adsk::core::Line3D"; }
+inline const char* Line3D::objectType() const { return classType(); }
+
+inline void* Line3D::queryInterface(const char* id) const
+{
+    if (isInterface(id, Line3D::classType()))
+        return const_cast<Line3D*>(this);
+    return Curve3D::queryInterface(id);
+}
+
+inline Line3D* Line3D::create_raw(Point3D* startPoint, Point3D* endPoint)
+{
+    if (!startPoint || !endPoint)
+        return nullptr;
+    return new headless::Line3DImpl(headless::valueOf(startPoint), headless::valueOf(endPoint));
+}
+
+}// namespace core
+}// namespace adsk
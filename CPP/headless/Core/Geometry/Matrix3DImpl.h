@@ -0,0 +1,225 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "Point3DImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+class Matrix3DImpl : public Matrix3D {
+public:
+    explicit Matrix3DImpl(const Mat4& value) : m_value(value) {}
+
+private:
+    bool setToIdentity_raw() override
+    {
+        m_value = identity();
+        return true;
+    }
+
+    bool invert_raw() override
+    {
+        Mat4 inverse;
+        if (!headless::invert(m_value, inverse))
+            return false;
+        m_value = inverse;
+        return true;
+    }
+
+    Matrix3D* copy_raw() const override { return new Matrix3DImpl(m_value); }
+    double determinant_raw() const override { return headless::determinant(m_value); }
+
+    // Applies the input matrix after this one.
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        if (!matrix)
+            return false;
+        m_value = valueOf(matrix) * m_value;
+        return true;
+    }
+
+    void getAsCoordinateSystem_raw(Point3D*& origin, Vector3D*& xAxis, Vector3D*& yAxis, Vector3D*& zAxis) const override
+    {
+        origin = newPoint(column(3));
+        xAxis = newVector(column(0));
+        yAxis = newVector(column(1));
+        zAxis = newVector(column(2));
+    }
+
+    bool setWithCoordinateSystem_raw(Point3D* origin, Vector3D* xAxis, Vector3D* yAxis, Vector3D* zAxis) override
+    {
+        if (!origin || !xAxis || !yAxis || !zAxis)
+            return false;
+        m_value = fromCoordinateSystem(valueOf(origin), valueOf(xAxis), valueOf(yAxis), valueOf(zAxis));
+        return true;
+    }
+
+    double getCell_raw(int row, int column) const override
+    {
+        if (!isCell(row, column))
+            return 0.0;
+        return m_value(row, column);
+    }
+
+    bool setCell_raw(int row, int column, double value) override
+    {
+        if (!isCell(row, column))
+            return false;
+        m_value(row, column) = value;
+        return true;
+    }
+
+    double* asArray_raw(size_t& return_size) const override
+    {
+        double* res = new double[16];
+        getAsArray_raw(res);
+        return_size = 16;
+        return res;
+    }
+
+    bool setWithArray_raw(const double* cells, size_t cells_size) override
+    {
+        if (!cells || cells_size != 16)
+            return false;
+        for (int i = 0; i < 16; ++i)
+            m_value.m[i] = cells[i];
+        return true;
+    }
+
+    bool isEqualTo_raw(Matrix3D* matrix) const override
+    {
+        if (!matrix)
+            return false;
+        Mat4 other = valueOf(matrix);
+        for (int i = 0; i < 16; ++i)
+        {
+            if (std::fabs(other.m[i] - m_value.m[i]) > pointTolerance)
+                return false;
+        }
+        return true;
+    }
+
+    Vector3D* translation_raw() const override { return newVector(column(3)); }
+
+    bool translation_raw(Vector3D* value) override
+    {
+        if (!value)
+            return false;
+        Vec3 t = valueOf(value);
+        m_value(0, 3) = t.x;
+        m_value(1, 3) = t.y;
+        m_value(2, 3) = t.z;
+        return true;
+    }
+
+    bool setToAlignCoordinateSystems_raw(Point3D* fromOrigin, Vector3D* fromXAxis, Vector3D* fromYAxis, Vector3D* fromZAxis, Point3D* toOrigin, Vector3D* toXAxis, Vector3D* toYAxis, Vector3D* toZAxis) override
+    {
+        if (!fromOrigin || !fromXAxis || !fromYAxis || !fromZAxis || !toOrigin || !toXAxis || !toYAxis || !toZAxis)
+            return false;
+        Mat4 from = fromCoordinateSystem(valueOf(fromOrigin), valueOf(fromXAxis), valueOf(fromYAxis), valueOf(fromZAxis));
+        Mat4 to = fromCoordinateSystem(valueOf(toOrigin), valueOf(toXAxis), valueOf(toYAxis), valueOf(toZAxis));
+        Mat4 fromInverse;
+        if (!headless::invert(from, fromInverse))
+            return false;
+        m_value = to * fromInverse;
+        return true;
+    }
+
+    // Without an axis the rotation is about the normal of the plane of the two vectors. With an
+    // axis, the rotation is about the axis by the angle between the projections of the vectors
+    // onto the plane perpendicular to it.
+    bool setToRotateTo_raw(Vector3D* from, Vector3D* to, Vector3D* axis) override
+    {
+        if (!from || !to)
+            return false;
+        Vec3 a = valueOf(from);
+        Vec3 b = valueOf(to);
+        Vec3 rotationAxis;
+        if (axis)
+        {
+            rotationAxis = valueOf(axis);
+            if (!normalize(rotationAxis))
+                return false;
+            a = a - rotationAxis * dot(a, rotationAxis);
+            b = b - rotationAxis * dot(b, rotationAxis);
+        }
+        if (!normalize(a) || !normalize(b))
+            return false;
+
+        double angle = angleBetween(a, b);
+        if (!axis)
+        {
+            rotationAxis = cross(a, b);
+            if (!normalize(rotationAxis))
+                rotationAxis = anyPerpendicular(a);
+        }
+        else if (dot(cross(a, b), rotationAxis) < 0.0)
+        {
+            angle = -angle;
+        }
+        m_value = rotation(angle, rotationAxis);
+        return true;
+    }
+
+    bool setToRotation_raw(double angle, Vector3D* axis, Point3D* origin) override
+    {
+        if (!axis || !origin)
+            return false;
+        Vec3 rotationAxis = valueOf(axis);
+        if (!normalize(rotationAxis))
+            return false;
+        Vec3 center = valueOf(origin);
+        Mat4 res = rotation(angle, rotationAxis);
+        Vec3 offset = center - transformVector(res, center);
+        res(0, 3) = offset.x;
+        res(1, 3) = offset.y;
+        res(2, 3) = offset.z;
+        m_value = res;
+        return true;
+    }
+
+    bool getAsArray_raw(double* cells) const override
+    {
+        if (!cells)
+            return false;
+        for (int i = 0; i < 16; ++i)
+            cells[i] = m_value.m[i];
+        return true;
+    }
+
+    static bool isCell(int row, int column) { return row >= 0 && row < 4 && column >= 0 && column < 4; }
+    Vec3 column(int index) const { return vec3(m_value(0, index), m_value(1, index), m_value(2, index)); }
+
+    Mat4 m_value;
+};
+
+}// namespace headless
+
+inline const char* Matrix3D::classType() { return "adsk::core::Matrix3D"; }
+inline const char* Matrix3D::objectType() const { return classType(); }
+
+inline void* Matrix3D::queryInterface(const char* id) const
+{
+    if (isInterface(id, Matrix3D::classType()))
+        return const_cast<Matrix3D*>(this);
+    if (isInterface(id, Base::classType()))
+        return static_cast<Base*>(const_cast<Matrix3D*>(this));
+    return nullptr;
+}
+
+inline Matrix3D* Matrix3D::create_raw()
+{
+    return new headless::Matrix3DImpl(headless::identity());
+}
+
+}// namespace core
+}// namespace adsk
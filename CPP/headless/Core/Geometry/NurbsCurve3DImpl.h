@@ -0,0 +1,524 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/NurbsCurve3D.h>
+#include "CurveEvaluator3DImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// The definition of a NURBS curve. Weights are empty for a non-rational curve.
+struct NurbsData
+{
+    static const int maxDegree = 7;
+
+    std::vector<Vec3> controlPoints;
+    int degree;
+    std::vector<double> knots;
+    std::vector<double> weights;
+    bool isPeriodic;
+
+    bool isRational() const { return !weights.empty(); }
+    double weight(size_t index) const { return weights.empty() ? 1.0 : weights[index]; }
+
+    /// Checks that the knot vector and weights are consistent with the control points. Degrees up
+    /// to maxDegree are supported.
+    bool isValid() const
+    {
+        size_t count = controlPoints.size();
+        if (degree < 1 || degree > maxDegree || count < static_cast<size_t>(degree) + 1 || knots.size() != count + degree + 1)
+            return false;
+        for (size_t i = 1; i < knots.size(); ++i)
+        {
+            if (knots[i] < knots[i - 1])
+                return false;
+        }
+        if (!(knots[degree] < knots[count]))
+            return false;
+        if (!weights.empty())
+        {
+            if (weights.size() != count)
+                return false;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!(weights[i] > 0.0))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    /// Returns the index of the knot span containing a parameter.
+    int findSpan(double parameter) const
+    {
+        int n = static_cast<int>(controlPoints.size()) - 1;
+        if (parameter >= knots[n + 1])
+            return n;
+        if (parameter <= knots[degree])
+            return degree;
+        int low = degree;
+        int high = n + 1;
+        int middle = (low + high) / 2;
+        while (parameter < knots[middle] || parameter >= knots[middle + 1])
+        {
+            if (parameter < knots[middle])
+                high = middle;
+            else
+                low = middle;
+            middle = (low + high) / 2;
+        }
+        return middle;
+    }
+
+    /// Computes the non-zero basis functions and their derivatives at a parameter, using the
+    /// algorithm of The NURBS Book (A2.3). derivatives[k][j] is the kth derivative of basis span - degree + j.
+    void basisDerivatives(int span, double parameter, int order, double derivatives[4][8]) const
+    {
+        const int p = degree;
+        double ndu[8][8];
+        double left[8];
+        double right[8];
+        ndu[0][0] = 1.0;
+        for (int j = 1; j <= p; ++j)
+        {
+            left[j] = parameter - knots[span + 1 - j];
+            right[j] = knots[span + j] - parameter;
+            double saved = 0.0;
+            for (int r = 0; r < j; ++r)
+            {
+                ndu[j][r] = right[r + 1] + left[j - r];
+                double temp = ndu[r][j - 1] / ndu[j][r];
+                ndu[r][j] = saved + right[r + 1] * temp;
+                saved = left[j - r] * temp;
+            }
+            ndu[j][j] = saved;
+        }
+        for (int j = 0; j <= p; ++j)
+            derivatives[0][j] = ndu[j][p];
+
+        double a[2][8];
+        for (int r = 0; r <= p; ++r)
+        {
+            int s1 = 0;
+            int s2 = 1;
+            a[0][0] = 1.0;
+            for (int k = 1; k <= order; ++k)
+            {
+                double d = 0.0;
+                int rk = r - k;
+                int pk = p - k;
+                if (r >= k)
+                {
+                    a[s2][0] = a[s1][0] / ndu[pk + 1][rk];
+                    d = a[s2][0] * ndu[rk][pk];
+                }
+                int j1 = rk >= -1 ? 1 : -rk;
+                int j2 = r - 1 <= pk ? k - 1 : p - r;
+                for (int j = j1; j <= j2; ++j)
+                {
+                    a[s2][j] = (a[s1][j] - a[s1][j - 1]) / ndu[pk + 1][rk + j];
+                    d += a[s2][j] * ndu[rk + j][pk];
+                }
+                if (r <= pk)
+                {
+                    a[s2][k] = -a[s1][k - 1] / ndu[pk + 1][r];
+                    d += a[s2][k] * ndu[r][pk];
+                }
+                derivatives[k][r] = d;
+                std::swap(s1, s2);
+            }
+        }
+        double factor = p;
+        for (int k = 1; k <= order; ++k)
+        {
+            for (int j = 0; j <= p; ++j)
+                derivatives[k][j] *= factor;
+            factor *= (p - k);
+        }
+    }
+
+    /// Evaluates the curve and its derivatives, applying the quotient rule to the homogeneous
+    /// derivatives of a rational curve (The NURBS Book, A4.2).
+    void evaluate(double parameter, int order, Vec3* values) const
+    {
+        int basisOrder = std::min(order, degree);
+        int span = findSpan(parameter);
+        double basis[4][8];
+        basisDerivatives(span, parameter, basisOrder, basis);
+
+        Vec3 homogeneous[4];
+        double w[4];
+        for (int k = 0; k <= order; ++k)
+        {
+            homogeneous[k] = vec3(0.0, 0.0, 0.0);
+            w[k] = 0.0;
+        }
+        for (int k = 0; k <= basisOrder; ++k)
+        {
+            for (int j = 0; j <= degree; ++j)
+            {
+                size_t index = span - degree + j;
+                double weighted = basis[k][j] * weight(index);
+                homogeneous[k] = homogeneous[k] + controlPoints[index] * weighted;
+                w[k] += weighted;
+            }
+        }
+
+        static const double binomial[4][4] = { { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 1, 2, 1, 0 }, { 1, 3, 3, 1 } };
+        for (int k = 0; k <= order; ++k)
+        {
+            Vec3 v = homogeneous[k];
+            for (int i = 1; i <= k; ++i)
+                v = v - values[k - i] * (binomial[k][i] * w[i]);
+            values[k] = v * (1.0 / w[0]);
+        }
+    }
+
+    /// Inserts a knot a number of times using Boehm's algorithm on the homogeneous control points.
+    void insertKnot(double parameter, int times)
+    {
+        for (int insertion = 0; insertion < times; ++insertion)
+        {
+            int span = findSpan(parameter);
+            std::vector<Vec3> points;
+            std::vector<double> newWeights;
+            points.reserve(controlPoints.size() + 1);
+            newWeights.reserve(controlPoints.size() + 1);
+            for (int i = 0; i <= static_cast<int>(controlPoints.size()); ++i)
+            {
+                if (i <= span - degree)
+                {
+                    points.push_back(controlPoints[i] * weight(i));
+                    newWeights.push_back(weight(i));
+                }
+                else if (i > span)
+                {
+                    points.push_back(controlPoints[i - 1] * weight(i - 1));
+                    newWeights.push_back(weight(i - 1));
+                }
+                else
+                {
+                    double alpha = (parameter - knots[i]) / (knots[i + degree] - knots[i]);
+                    points.push_back(controlPoints[i] * (alpha * weight(i)) + controlPoints[i - 1] * ((1.0 - alpha) * weight(i - 1)));
+                    newWeights.push_back(alpha * weight(i) + (1.0 - alpha) * weight(i - 1));
+                }
+            }
+            for (size_t i = 0; i < points.size(); ++i)
+                points[i] = points[i] * (1.0 / newWeights[i]);
+            controlPoints.swap(points);
+            if (isRational())
+                weights.swap(newWeights);
+            knots.insert(knots.begin() + span + 1, parameter);
+        }
+    }
+
+    size_t multiplicity(double parameter) const
+    {
+        return std::count(knots.begin(), knots.end(), parameter);
+    }
+
+    /// Moves a parameter onto a nearby knot so splitting doesn't create nearly coincident knots.
+    double snapToKnot(double parameter) const
+    {
+        double tolerance = 1.0e-12 * std::max(1.0, knots.back() - knots.front());
+        for (size_t i = 0; i < knots.size(); ++i)
+        {
+            if (std::fabs(knots[i] - parameter) <= tolerance)
+                return knots[i];
+        }
+        return parameter;
+    }
+
+    bool isClampedStart() const { return multiplicity(knots.front()) >= static_cast<size_t>(degree) + 1; }
+    bool isClampedEnd() const { return multiplicity(knots.back()) >= static_cast<size_t>(degree) + 1; }
+};
+
+class NurbsCurve3DImpl : public NurbsCurve3D, public CurveGeometry {
+public:
+    explicit NurbsCurve3DImpl(const NurbsData& data) : m_data(data) {}
+
+    const NurbsData& data() const { return m_data; }
+
+    void extents(double& startParameter, double& endParameter) const override
+    {
+        startParameter = m_data.knots[m_data.degree];
+        endParameter = m_data.knots[m_data.controlPoints.size()];
+    }
+
+    void evaluate(double parameter, int order, Vec3* values) const override
+    {
+        m_data.evaluate(parameter, order, values);
+    }
+
+    void spans(std::vector<double>& parameters) const override
+    {
+        double start, end;
+        extents(start, end);
+        parameters.clear();
+        for (size_t i = m_data.degree; i <= m_data.controlPoints.size(); ++i)
+        {
+            if (parameters.empty() || m_data.knots[i] > parameters.back())
+                parameters.push_back(m_data.knots[i]);
+        }
+    }
+
+    int samplesPerSpan() const override { return 2 * m_data.degree + 2; }
+
+    static NurbsData dataFrom(Point3D** controlPoints, size_t controlPoints_size, int degree, const double* knots, size_t knots_size, const double* weights, size_t weights_size, bool isPeriodic)
+    {
+        NurbsData data;
+        data.degree = degree;
+        data.isPeriodic = isPeriodic;
+        for (size_t i = 0; i < controlPoints_size; ++i)
+            data.controlPoints.push_back(valueOf(controlPoints[i]));
+        if (knots)
+            data.knots.assign(knots, knots + knots_size);
+        if (weights)
+            data.weights.assign(weights, weights + weights_size);
+        return data;
+    }
+
+private:
+    Curve3DTypes curveType_raw() const override { return NurbsCurve3DCurveType; }
+    CurveEvaluator3D* evaluator_raw() const override { return new CurveEvaluator3DImpl(this, this); }
+
+    CurveEvaluator3D* detachedEvaluator_raw() const override
+    {
+        NurbsCurve3DImpl* copy = new NurbsCurve3DImpl(m_data);
+        CurveEvaluator3D* res = new CurveEvaluator3DImpl(copy, copy);
+        copy->release();
+        return res;
+    }
+
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        if (!matrix)
+            return false;
+        Mat4 m = valueOf(matrix);
+        for (size_t i = 0; i < m_data.controlPoints.size(); ++i)
+            m_data.controlPoints[i] = transformPoint(m, m_data.controlPoints[i]);
+        return true;
+    }
+
+    int controlPointCount_raw() const override { return static_cast<int>(m_data.controlPoints.size()); }
+    int degree_raw() const override { return m_data.degree; }
+    int knotCount_raw() const override { return static_cast<int>(m_data.knots.size()); }
+    bool isRational_raw() const override { return m_data.isRational(); }
+
+    bool isClosed_raw() const override
+    {
+        double start, end;
+        extents(start, end);
+        return length(pointAt(start) - pointAt(end)) <= pointTolerance;
+    }
+
+    bool isPeriodic_raw() const override { return m_data.isPeriodic; }
+
+    Point3D** controlPoints_raw(size_t& return_size) const override
+    {
+        Point3D** res = new Point3D*[m_data.controlPoints.size()];
+        for (size_t i = 0; i < m_data.controlPoints.size(); ++i)
+            res[i] = newPoint(m_data.controlPoints[i]);
+        return_size = m_data.controlPoints.size();
+        return res;
+    }
+
+    double* knots_raw(size_t& return_size) const override
+    {
+        return copyOf(m_data.knots, return_size);
+    }
+
+    bool getData_raw(Point3D**& controlPoints, size_t& controlPoints_size, int& degree, double*& knots, size_t& knots_size, bool& isRational, double*& weights, size_t& weights_size, bool& isPeriodic) const override
+    {
+        controlPoints = controlPoints_raw(controlPoints_size);
+        degree = m_data.degree;
+        knots = copyOf(m_data.knots, knots_size);
+        isRational = m_data.isRational();
+        weights = copyOf(m_data.weights, weights_size);
+        isPeriodic = m_data.isPeriodic;
+        return true;
+    }
+
+    bool set_raw(Point3D** controlPoints, size_t controlPoints_size, int degree, const double* knots, size_t knots_size, bool isRational, const double* weights, size_t weights_size, bool isPeriodic) override
+    {
+        NurbsData data = dataFrom(controlPoints, controlPoints_size, degree, knots, knots_size, isRational ? weights : nullptr, weights_size, isPeriodic);
+        if (isRational && data.weights.empty())
+            return false;
+        if (!data.isValid())
+            return false;
+        m_data = data;
+        return true;
+    }
+
+    // Splits the curve at both parameters by raising the multiplicity of each to the degree, after
+    // which the control points between them define the requested piece exactly.
+    NurbsCurve3D* extract_raw(double startParam, double endParam) const override
+    {
+        double start, end;
+        extents(start, end);
+        if (!(startParam < endParam) || startParam < start || endParam > end)
+            return nullptr;
+        NurbsData data = m_data;
+        const int p = data.degree;
+        startParam = data.snapToKnot(startParam);
+        endParam = data.snapToKnot(endParam);
+        int times = p - static_cast<int>(data.multiplicity(startParam));
+        if (times > 0)
+            data.insertKnot(startParam, times);
+        times = p - static_cast<int>(data.multiplicity(endParam));
+        if (times > 0)
+            data.insertKnot(endParam, times);
+
+        int a = static_cast<int>(std::upper_bound(data.knots.begin(), data.knots.end(), startParam) - data.knots.begin()) - p;
+        int b = static_cast<int>(std::lower_bound(data.knots.begin(), data.knots.end(), endParam) - data.knots.begin()) + p - 1;
+
+        NurbsData piece;
+        piece.degree = p;
+        piece.isPeriodic = false;
+        piece.knots.push_back(startParam);
+        piece.knots.insert(piece.knots.end(), data.knots.begin() + a, data.knots.begin() + b + 1);
+        piece.knots.push_back(endParam);
+        piece.controlPoints.assign(data.controlPoints.begin() + (a - 1), data.controlPoints.begin() + (b - p) + 1);
+        if (data.isRational())
+            piece.weights.assign(data.weights.begin() + (a - 1), data.weights.begin() + (b - p) + 1);
+        if (!piece.isValid())
+            return nullptr;
+        return new NurbsCurve3DImpl(piece);
+    }
+
+    // Joins a curve that starts where this one ends. Both curves must have the same degree and be
+    // clamped at the joint. The knots of the second curve are shifted to follow on from this one.
+    NurbsCurve3D* merge_raw(NurbsCurve3D* nurbsCurve) const override
+    {
+        const NurbsCurve3DImpl* other = dynamic_cast<const NurbsCurve3DImpl*>(nurbsCurve);
+        if (!other)
+            return nullptr;
+        const NurbsData& first = m_data;
+        const NurbsData& second = other->m_data;
+        const int p = first.degree;
+        if (second.degree != p || !first.isClampedEnd() || !second.isClampedStart())
+            return nullptr;
+        if (length(first.controlPoints.back() - second.controlPoints.front()) > pointTolerance)
+            return nullptr;
+
+        NurbsData res;
+        res.degree = p;
+        res.isPeriodic = false;
+        res.controlPoints = first.controlPoints;
+        res.controlPoints.insert(res.controlPoints.end(), second.controlPoints.begin() + 1, second.controlPoints.end());
+        res.knots.assign(first.knots.begin(), first.knots.end() - 1);
+        double shift = first.knots.back() - second.knots.front();
+        for (size_t i = p + 1; i < second.knots.size(); ++i)
+            res.knots.push_back(second.knots[i] + shift);
+        if (first.isRational() || second.isRational())
+        {
+            // Scale the weights of the second curve so the weights agree at the shared control point.
+            double scale = first.weight(first.controlPoints.size() - 1) / second.weight(0);
+            for (size_t i = 0; i < first.controlPoints.size(); ++i)
+                res.weights.push_back(first.weight(i));
+            for (size_t i = 1; i < second.controlPoints.size(); ++i)
+                res.weights.push_back(second.weight(i) * scale);
+        }
+        if (!res.isValid())
+            return nullptr;
+        return new NurbsCurve3DImpl(res);
+    }
+
+    NurbsCurve3D* copy_raw() const override { return new NurbsCurve3DImpl(m_data); }
+
+    bool reverse_raw() override
+    {
+        std::reverse(m_data.controlPoints.begin(), m_data.controlPoints.end());
+        std::reverse(m_data.weights.begin(), m_data.weights.end());
+        double sum = m_data.knots.front() + m_data.knots.back();
+        std::vector<double> knots(m_data.knots.size());
+        for (size_t i = 0; i < knots.size(); ++i)
+            knots[i] = sum - m_data.knots[knots.size() - 1 - i];
+        m_data.knots.swap(knots);
+        return true;
+    }
+
+    bool getControlPoints_raw(double* coordinates, size_t capacity, size_t& count) const override
+    {
+        count = 3 * m_data.controlPoints.size();
+        if (count > capacity)
+            return true;
+        if (!coordinates && count > 0)
+            return false;
+        for (size_t i = 0; i < m_data.controlPoints.size(); ++i)
+        {
+            coordinates[3 * i] = m_data.controlPoints[i].x;
+            coordinates[3 * i + 1] = m_data.controlPoints[i].y;
+            coordinates[3 * i + 2] = m_data.controlPoints[i].z;
+        }
+        return true;
+    }
+
+    bool getKnots_raw(double* knots, size_t capacity, size_t& count) const override
+    {
+        count = m_data.knots.size();
+        if (count > capacity)
+            return true;
+        if (!knots && count > 0)
+            return false;
+        std::copy(m_data.knots.begin(), m_data.knots.end(), knots);
+        return true;
+    }
+
+    static double* copyOf(const std::vector<double>& values, size_t& size)
+    {
+        size = values.size();
+        if (values.empty())
+            return nullptr;
+        double* res = new double[values.size()];
+        std::copy(values.begin(), values.end(), res);
+        return res;
+    }
+
+    NurbsData m_data;
+};
+
+/// Creates a NURBS curve, returning it with the reference owned by the caller, or null if the
+/// definition is not valid.
+inline NurbsCurve3D* newNurbsCurve(const NurbsData& data)
+{
+    if (!data.isValid())
+        return nullptr;
+    return new NurbsCurve3DImpl(data);
+}
+
+}// namespace headless
+
+inline const char* NurbsCurve3D::classType() { return "adsk::core::NurbsCurve3D"; }
+inline const char* NurbsCurve3D::objectType() const { return classType(); }
+
+inline void* NurbsCurve3D::queryInterface(const char* id) const
+{
+    if (isInterface(id, NurbsCurve3D::classType()))
+        return const_cast<NurbsCurve3D*>(this);
+    return Curve3D::queryInterface(id);
+}
+
+inline NurbsCurve3D* NurbsCurve3D::createNonRational_raw(Point3D** controlPoints, size_t controlPoints_size, int degree, const double* knots, size_t knots_size, bool isPeriodic)
+{
+    return headless::newNurbsCurve(headless::NurbsCurve3DImpl::dataFrom(controlPoints, controlPoints_size, degree, knots, knots_size, nullptr, 0, isPeriodic));
+}
+
+inline NurbsCurve3D* NurbsCurve3D::createRational_raw(Point3D** controlPoints, size_t controlPoints_size, int degree, const double* knots, size_t knots_size, const double* weights, size_t weights_size, bool isPeriodic)
+{
+    if (!weights || weights_size == 0)
+        return nullptr;
+    return headless::newNurbsCurve(headless::NurbsCurve3DImpl::dataFrom(controlPoints, controlPoints_size, degree, knots, knots_size, weights, weights_size, isPeriodic));
+}
+
+}// namespace core
+}// namespace adsk
@@ -0,0 +1,170 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/Point3D.h>
+#include <Core/Geometry/Vector3D.h>
+#include <Core/Geometry/Matrix3D.h>
+#include "HeadlessMath.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// Returns the coordinates of a point.
+inline Vec3 valueOf(const Point3D* point)
+{
+    Vec3 res = { 0.0, 0.0, 0.0 };
+    if (point)
+        point->getData(res.x, res.y, res.z);
+    return res;
+}
+
+/// Returns the components of a vector.
+inline Vec3 valueOf(const Vector3D* vector)
+{
+    double components[3] = { 0.0, 0.0, 0.0 };
+    if (vector)
+        vector->getAsArray(components);
+    return vec3(components[0], components[1], components[2]);
+}
+
+/// Returns the cells of a matrix, or the identity for a null matrix.
+inline Mat4 valueOf(const Matrix3D* matrix)
+{
+    Mat4 res = identity();
+    if (matrix)
+        matrix->getAsArray(res.m);
+    return res;
+}
+
+/// Creates a point, returning it with the reference owned by the caller.
+inline Point3D* newPoint(const Vec3& value)
+{
+    return Point3D::create(value.x, value.y, value.z).detach();
+}
+
+/// Creates a vector, returning it with the reference owned by the caller.
+inline Vector3D* newVector(const Vec3& value)
+{
+    return Vector3D::create(value.x, value.y, value.z).detach();
+}
+
+class Point3DImpl : public Point3D {
+public:
+    explicit Point3DImpl(const Vec3& value) : m_value(value) {}
+
+private:
+    double distanceTo_raw(Point3D* point) const override { return length(valueOf(point) - m_value); }
+    Point3D* copy_raw() const override { return new Point3DImpl(m_value); }
+
+    double* asArray_raw(size_t& return_size) const override
+    {
+        double* res = new double[3];
+        getAsArray_raw(res);
+        return_size = 3;
+        return res;
+    }
+
+    bool isEqualTo_raw(Point3D* point) const override { return point && length(valueOf(point) - m_value) <= pointTolerance; }
+
+    bool setWithArray_raw(const double* coordinates, size_t coordinates_size) override
+    {
+        if (!coordinates || coordinates_size != 3)
+            return false;
+        m_value = vec3(coordinates[0], coordinates[1], coordinates[2]);
+        return true;
+    }
+
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        if (!matrix)
+            return false;
+        m_value = transformPoint(valueOf(matrix), m_value);
+        return true;
+    }
+
+    double x_raw() const override { return m_value.x; }
+    bool x_raw(double value) override { m_value.x = value; return true; }
+    double y_raw() const override { return m_value.y; }
+    bool y_raw(double value) override { m_value.y = value; return true; }
+    double z_raw() const override { return m_value.z; }
+    bool z_raw(double value) override { m_value.z = value; return true; }
+
+    Vector3D* asVector_raw() const override { return newVector(m_value); }
+
+    bool translateBy_raw(Vector3D* vector) override
+    {
+        if (!vector)
+            return false;
+        m_value = m_value + valueOf(vector);
+        return true;
+    }
+
+    bool getData_raw(double& x, double& y, double& z) const override
+    {
+        x = m_value.x;
+        y = m_value.y;
+        z = m_value.z;
+        return true;
+    }
+
+    bool set_raw(double x, double y, double z) override
+    {
+        m_value = vec3(x, y, z);
+        return true;
+    }
+
+    Vector3D* vectorTo_raw(Point3D* point) const override
+    {
+        if (!point)
+            return nullptr;
+        return newVector(valueOf(point) - m_value);
+    }
+
+    bool isEqualToByTolerance_raw(Point3D* point, double tolerance) const override
+    {
+        return point && length(valueOf(point) - m_value) <= tolerance;
+    }
+
+    bool getAsArray_raw(double* coordinates) const override
+    {
+        if (!coordinates)
+            return false;
+        coordinates[0] = m_value.x;
+        coordinates[1] = m_value.y;
+        coordinates[2] = m_value.z;
+        return true;
+    }
+
+    Vec3 m_value;
+};
+
+}// namespace headless
+
+inline const char* Point3D::classType() { return "adsk::core::Point3D"; }
+inline const char* Point3D::objectType() const { return classType(); }
+
+inline void* Point3D::queryInterface(const char* id) const
+{
+    if (isInterface(id, Point3D::classType()))
+        return const_cast<Point3D*>(this);
+    if (isInterface(id, Base::classType()))
+        return static_cast<Base*>(const_cast<Point3D*>(this));
+    return nullptr;
+}
+
+inline Point3D* Point3D::create_raw(double x, double y, double z)
+{
+    return new headless::Point3DImpl(headless::vec3(x, y, z));
+}
+
+}// namespace core
+}// namespace adsk
@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/Sphere.h>
+#include "SurfaceImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// Sphere that holds only its defining data. It has no SurfaceEvaluator, so evaluator returns
+/// null; AnalyticSurfaceEvaluator evaluates it from its data.
+class SphereImpl : public Sphere {
+public:
+    SphereImpl(const Vec3& origin, double radius) : m_origin(origin), m_radius(radius) {}
+
+private:
+    SurfaceTypes surfaceType_raw() const override { return SphereSurfaceType; }
+    SurfaceEvaluator* evaluator_raw() const override { return nullptr; }
+
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        Vec3 origin = m_origin;
+        Vec3 axis = vec3(0.0, 0.0, 1.0);
+        double scale = 1.0;
+        if (!transformPlacement(matrix, origin, axis, nullptr, scale))
+            return false;
+        m_origin = origin;
+        m_radius *= scale;
+        return true;
+    }
+
+    Point3D* origin_raw() const override { return newPoint(m_origin); }
+
+    bool origin_raw(Point3D* value) override
+    {
+        if (!value)
+            return false;
+        m_origin = valueOf(value);
+        return true;
+    }
+
+    double radius_raw() const override { return m_radius; }
+
+    bool radius_raw(double value) override
+    {
+        if (!(value > 0.0))
+            return false;
+        m_radius = value;
+        return true;
+    }
+
+    bool getData_raw(Point3D*& origin, double& radius) const override
+    {
+        origin = newPoint(m_origin);
+        radius = m_radius;
+        return true;
+    }
+
+    bool set_raw(Point3D* origin, double radius) override
+    {
+        if (!origin || !(radius > 0.0))
+            return false;
+        m_origin = valueOf(origin);
+        m_radius = radius;
+        return true;
+    }
+
+    Sphere* copy_raw() const override { return new SphereImpl(m_origin, m_radius); }
+
+    Vec3 m_origin;
+    double m_radius;
+};
+
+}// namespace headless
+
+inline const char* Sphere::classType() { return "adsk::core::Sphere"; }
+inline const char* Sphere::objectType() const { return classType(); }
+
+inline void* Sphere::queryInterface(const char* id) const
+{
+    if (isInterface(id, Sphere::classType()))
+        return const_cast<Sphere*>(this);
+    return Surface::queryInterface(id);
+}
+
+inline Sphere* Sphere::create_raw(Point3D* origin, double radius)
+{
+    if (!origin || !(radius > 0.0))
+        return nullptr;
+    return new headless::SphereImpl(headless::valueOf(origin), radius);
+}
+
+}// namespace core
+}// namespace adsk
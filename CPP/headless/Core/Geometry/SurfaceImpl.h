@@ -0,0 +1,71 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/Surface.h>
+#include "Vector3DImpl.h"
+#include "Matrix3DImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// Transforms the placement of an analytic surface. Only transformations made of rotation,
+/// translation, mirroring and uniform scaling keep a surface of the same type, so other
+/// transformations are rejected and nothing is changed.
+/// origin : The origin of the surface, transformed as a point.
+/// axis : The unit axis of the surface, transformed as a direction.
+/// reference : An optional second unit direction of the surface, such as its major axis.
+/// scale : The output factor by which the lengths of the surface are scaled.
+inline bool transformPlacement(Matrix3D* matrix, Vec3& origin, Vec3& axis, Vec3* reference, double& scale)
+{
+    if (!matrix)
+        return false;
+    Mat4 m = valueOf(matrix);
+    Vec3 xAxis = transformVector(m, vec3(1.0, 0.0, 0.0));
+    Vec3 yAxis = transformVector(m, vec3(0.0, 1.0, 0.0));
+    Vec3 zAxis = transformVector(m, vec3(0.0, 0.0, 1.0));
+    scale = length(xAxis);
+    if (scale <= 0.0 || std::fabs(length(yAxis) - scale) > angleTolerance * scale ||
+        std::fabs(length(zAxis) - scale) > angleTolerance * scale ||
+        !isPerpendicular(xAxis, yAxis) || !isPerpendicular(yAxis, zAxis) || !isPerpendicular(zAxis, xAxis))
+        return false;
+    origin = transformPoint(m, origin);
+    axis = transformVector(m, axis) * (1.0 / scale);
+    if (reference)
+        *reference = transformVector(m, *reference) * (1.0 / scale);
+    return true;
+}
+
+/// Checks and normalizes the axis of a surface and, when given, a major axis that must be
+/// perpendicular to it.
+inline bool makeSurfaceAxes(Vec3& axis, Vec3* majorAxis = nullptr)
+{
+    if (!normalize(axis))
+        return false;
+    return !majorAxis || (normalize(*majorAxis) && isPerpendicular(axis, *majorAxis));
+}
+
+}// namespace headless
+
+inline const char* Surface::classType() { return "adsk::core::Surface"; }
+inline const char* Surface::objectType() const { return classType(); }
+
+inline void* Surface::queryInterface(const char* id) const
+{
+    if (isInterface(id, Surface::classType()))
+        return const_cast<Surface*>(this);
+    if (isInterface(id, Base::classType()))
+        return static_cast<Base*>(const_cast<Surface*>(this));
+    return nullptr;
+}
+
+}// namespace core
+}// namespace adsk
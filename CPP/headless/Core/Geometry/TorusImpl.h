@@ -0,0 +1,132 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <Core/Geometry/Torus.h>
+#include "SurfaceImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+/// Torus that holds only its defining data. It has no SurfaceEvaluator, so evaluator returns null;
+/// AnalyticSurfaceEvaluator evaluates it from its data.
+class TorusImpl : public Torus {
+public:
+    TorusImpl(const Vec3& origin, const Vec3& axis, double majorRadius, double minorRadius)
+        : m_origin(origin), m_axis(axis), m_majorRadius(majorRadius), m_minorRadius(minorRadius)
+    {}
+
+private:
+    SurfaceTypes surfaceType_raw() const override { return TorusSurfaceType; }
+    SurfaceEvaluator* evaluator_raw() const override { return nullptr; }
+
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        double scale = 1.0;
+        if (!transformPlacement(matrix, m_origin, m_axis, nullptr, scale))
+            return false;
+        m_majorRadius *= scale;
+        m_minorRadius *= scale;
+        return true;
+    }
+
+    Point3D* origin_raw() const override { return newPoint(m_origin); }
+
+    bool origin_raw(Point3D* value) override
+    {
+        if (!value)
+            return false;
+        m_origin = valueOf(value);
+        return true;
+    }
+
+    Vector3D* axis_raw() const override { return newVector(m_axis); }
+
+    bool axis_raw(Vector3D* value) override
+    {
+        Vec3 axis = valueOf(value);
+        if (!value || !makeSurfaceAxes(axis))
+            return false;
+        m_axis = axis;
+        return true;
+    }
+
+    double majorRadius_raw() const override { return m_majorRadius; }
+
+    bool majorRadius_raw(double value) override
+    {
+        if (!(value > 0.0))
+            return false;
+        m_majorRadius = value;
+        return true;
+    }
+
+    double minorRadius_raw() const override { return m_minorRadius; }
+
+    bool minorRadius_raw(double value) override
+    {
+        if (!(value > 0.0))
+            return false;
+        m_minorRadius = value;
+        return true;
+    }
+
+    bool getData_raw(Point3D*& origin, Vector3D*& axis, double& majorRadius, double& minorRadius) const override
+    {
+        origin = newPoint(m_origin);
+        axis = newVector(m_axis);
+        majorRadius = m_majorRadius;
+        minorRadius = m_minorRadius;
+        return true;
+    }
+
+    bool set_raw(Point3D* origin, Vector3D* axis, double majorRadius, double minorRadius) override
+    {
+        Vec3 a = valueOf(axis);
+        if (!origin || !axis || !makeSurfaceAxes(a) || !(majorRadius > 0.0) || !(minorRadius > 0.0))
+            return false;
+        m_origin = valueOf(origin);
+        m_axis = a;
+        m_majorRadius = majorRadius;
+        m_minorRadius = minorRadius;
+        return true;
+    }
+
+    Torus* copy_raw() const override { return new TorusImpl(m_origin, m_axis, m_majorRadius, m_minorRadius); }
+
+    Vec3 m_origin;
+    Vec3 m_axis;
+    double m_majorRadius;
+    double m_minorRadius;
+};
+
+}// namespace headless
+
+inline const char* Torus::classType() { return "adsk::core::Torus"; }
+inline const char* Torus::objectType() const { return classType(); }
+
+inline void* Torus::queryInterface(const char* id) const
+{
+    if (isInterface(id, Torus::classType()))
+        return const_cast<Torus*>(this);
+    return Surface::queryInterface(id);
+}
+
+inline Torus* Torus::create_raw(Point3D* origin, Vector3D* axis, double majorRadius, double minorRadius)
+{
+    headless::Vec3 a = headless::valueOf(axis);
+    if (!origin || !axis || !headless::makeSurfaceAxes(a) || !(majorRadius > 0.0) || !(minorRadius > 0.0))
+        return nullptr;
+    return new headless::TorusImpl(headless::valueOf(origin), a, majorRadius, minorRadius);
+}
+
+}// namespace core
+}// namespace adsk
@@ -0,0 +1,129 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "Point3DImpl.h"
+
+namespace adsk { namespace core {
+
+namespace headless {
+
+class Vector3DImpl : public Vector3D {
+public:
+    explicit Vector3DImpl(const Vec3& value) : m_value(value) {}
+
+private:
+    bool add_raw(Vector3D* vector) override
+    {
+        if (!vector)
+            return false;
+        m_value = m_value + valueOf(vector);
+        return true;
+    }
+
+    double angleTo_raw(Vector3D* vector) const override { return angleBetween(m_value, valueOf(vector)); }
+    Point3D* asPoint_raw() const override { return newPoint(m_value); }
+    Vector3D* copy_raw() const override { return new Vector3DImpl(m_value); }
+
+    Vector3D* crossProduct_raw(Vector3D* vector) const override
+    {
+        if (!vector)
+            return nullptr;
+        return new Vector3DImpl(cross(m_value, valueOf(vector)));
+    }
+
+    double dotProduct_raw(Vector3D* vector) const override { return dot(m_value, valueOf(vector)); }
+
+    double* asArray_raw(size_t& return_size) const override
+    {
+        double* res = new double[3];
+        getAsArray_raw(res);
+        return_size = 3;
+        return res;
+    }
+
+    bool isEqualTo_raw(Vector3D* vector) const override { return vector && headless::length(valueOf(vector) - m_value) <= pointTolerance; }
+    bool isParallelTo_raw(Vector3D* vector) const override { return vector && isParallel(m_value, valueOf(vector)); }
+    bool isPerpendicularTo_raw(Vector3D* vector) const override { return vector && isPerpendicular(m_value, valueOf(vector)); }
+    double length_raw() const override { return headless::length(m_value); }
+    bool normalize_raw() override { return headless::normalize(m_value); }
+
+    bool setWithArray_raw(const double* coordinates, size_t coordinates_size) override
+    {
+        if (!coordinates || coordinates_size != 3)
+            return false;
+        m_value = vec3(coordinates[0], coordinates[1], coordinates[2]);
+        return true;
+    }
+
+    bool scaleBy_raw(double scale) override
+    {
+        m_value = m_value * scale;
+        return true;
+    }
+
+    bool subtract_raw(Vector3D* vector) override
+    {
+        if (!vector)
+            return false;
+        m_value = m_value - valueOf(vector);
+        return true;
+    }
+
+    // Vectors are not affected by the translation of the matrix.
+    bool transformBy_raw(Matrix3D* matrix) override
+    {
+        if (!matrix)
+            return false;
+        m_value = transformVector(valueOf(matrix), m_value);
+        return true;
+    }
+
+    double x_raw() const override { return m_value.x; }
+    bool x_raw(double value) override { m_value.x = value; return true; }
+    double y_raw() const override { return m_value.y; }
+    bool y_raw(double value) override { m_value.y = value; return true; }
+    double z_raw() const override { return m_value.z; }
+    bool z_raw(double value) override { m_value.z = value; return true; }
+
+    bool getAsArray_raw(double* coordinates) const override
+    {
+        if (!coordinates)
+            return false;
+        coordinates[0] = m_value.x;
+        coordinates[1] = m_value.y;
+        coordinates[2] = m_value.z;
+        return true;
+    }
+
+    Vec3 m_value;
+};
+
+}// namespace headless
+
+inline const char* Vector3D::classType() { return "adsk::core::Vector3D"; }
+inline const char* Vector3D::objectType() const { return classType(); }
+
+inline void* Vector3D::queryInterface(const char* id) const
+{
+    if (isInterface(id, Vector3D::classType()))
+        return const_cast<Vector3D*>(this);
+    if (isInterface(id, Base::classType()))
+        return static_cast<Base*>(const_cast<Vector3D*>(this));
+    return nullptr;
+}
+
+inline Vector3D* Vector3D::create_raw(double x, double y, double z)
+{
+    return new headless::Vector3DImpl(headless::vec3(x, y, z));
+}
+
+}// namespace core
+}// namespace adsk
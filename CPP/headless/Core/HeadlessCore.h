@@ -0,0 +1,22 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Everything in the headless implementation: the geometry types described in
+// Geometry/HeadlessGeometry.h, plus ObjectCollection and a stand-alone Attribute created with
+// headless::newAttribute. Compile with the same include directories as HeadlessGeometry.h and
+// include it as
+//
+//     #include <HeadlessCore.h>
+
+#include "Geometry/HeadlessGeometry.h"
+#include "Application/ObjectCollectionImpl.h"
+#include "Application/AttributeImpl.h"
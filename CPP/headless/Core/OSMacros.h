@@ -0,0 +1,22 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+// Stand-in for the OSMacros.h that ships with Fusion. The headless implementation is compiled into
+// the client, so nothing is imported from or exported to a library.
+
+#ifndef XI_EXPORT
+# define XI_EXPORT
+#endif
+
+#ifndef XI_IMPORT
+# define XI_IMPORT
+#endif
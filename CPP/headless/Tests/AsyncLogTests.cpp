@@ -0,0 +1,208 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Tests of AsyncLog: several threads writing while the log is drained in the background, the
+// round trip of the records through BinaryFileLogSink and readBinaryLog, and ApplicationLogSink.
+// Build with ThreadSanitizer, from the root of the repository, and run the result:
+//
+//     g++ -std=c++17 -O1 -g -fsanitize=thread -I CPP/include -I CPP/headless/Core -I CPP/headless/Core/Geometry
+//         CPP/headless/Tests/AsyncLogTests.cpp -o AsyncLogTests -pthread
+//
+// The executable returns 0 if every check passed. ThreadSanitizer reports races on stderr and
+// makes the executable return a non-zero code.
+
+#include <HeadlessCore.h>
+#include <Core/Application/AsyncLog.h>
+#include "HeadlessTest.h"
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace adsk::core;
+
+namespace {
+
+struct LoggedMessage
+{
+    std::string message;
+    LogLevels level;
+    LogTypes type;
+};
+
+std::vector<LoggedMessage>& loggedMessages()
+{
+    static std::vector<LoggedMessage> messages;
+    return messages;
+}
+
+std::string temporaryFilename(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string res = directory && *directory ? directory : "/tmp";
+    res += '/';
+    res += name;
+    return res;
+}
+
+// Returns the value of an integer field of a record, or -1 if the record doesn't have the field.
+int64_t integerField(const LogRecord& record, const char* name)
+{
+    for (const LogRecord::Field& field : record.fields())
+    {
+        if (field.kind == LogField::IntegerKind && field.name() == name)
+            return field.integer;
+    }
+    return -1;
+}
+
+// Four threads write 20000 records each into small buffers while a background thread drains them
+// to a binary file. A record that is dropped because its buffer is full is written again, so every
+// record reaches the file and the records of each thread must be read back in the order written.
+void testConcurrentWritersRoundTrip()
+{
+    const int threadCount = 4;
+    const int recordsPerThread = 20000;
+    const std::string filename = temporaryFilename("AsyncLogTests.bin");
+
+    std::vector<int> retries(threadCount, 0);
+    {
+        AsyncLog log(4 * 1024);
+        std::unique_ptr<BinaryFileLogSink> sink(new BinaryFileLogSink(filename));
+        HEADLESS_CHECK(sink->isOpen());
+        log.addSink(std::move(sink));
+        HEADLESS_CHECK(log.start(std::chrono::milliseconds(1)));
+        HEADLESS_CHECK(!log.start());
+
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < threadCount; ++thread)
+        {
+            threads.emplace_back([&log, &retries, thread] {
+                for (int sequence = 0; sequence < recordsPerThread; ++sequence)
+                {
+                    while (!log.write(InfoLogLevel, "record", { { "thread", thread }, { "sequence", sequence }, { "even", sequence % 2 == 0 } }))
+                    {
+                        ++retries[thread];
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+            thread.join();
+        log.stop();
+
+        uint64_t totalRetries = 0;
+        for (int count : retries)
+            totalRetries += count;
+        HEADLESS_CHECK(log.droppedCount() == totalRetries);
+        HEADLESS_CHECK(log.flush() == 0);
+    }
+
+    std::vector<int> nextSequence(threadCount, 0);
+    std::vector<uint32_t> threadIndices(threadCount, UINT32_MAX);
+    std::vector<uint64_t> lastTimestamp(threadCount, 0);
+    size_t recordCount = 0;
+    bool isRead = readBinaryLog(filename, [&](const LogRecord& record) {
+        ++recordCount;
+        int64_t thread = integerField(record, "thread");
+        int64_t sequence = integerField(record, "sequence");
+        if (!HEADLESS_CHECK(thread >= 0 && thread < threadCount))
+            return;
+        HEADLESS_CHECK(record.level() == InfoLogLevel);
+        HEADLESS_CHECK(record.message() == "record");
+        HEADLESS_CHECK(record.fieldCount() == 3);
+        HEADLESS_CHECK(sequence == nextSequence[thread]);
+        nextSequence[thread] = static_cast<int>(sequence) + 1;
+        HEADLESS_CHECK(record.timestamp() >= lastTimestamp[thread]);
+        lastTimestamp[thread] = record.timestamp();
+        if (threadIndices[thread] == UINT32_MAX)
+            threadIndices[thread] = record.threadIndex();
+        HEADLESS_CHECK(record.threadIndex() == threadIndices[thread]);
+    });
+    HEADLESS_CHECK(isRead);
+    HEADLESS_CHECK(recordCount == static_cast<size_t>(threadCount * recordsPerThread));
+    for (int thread = 0; thread < threadCount; ++thread)
+        HEADLESS_CHECK(nextSequence[thread] == recordsPerThread);
+    std::remove(filename.c_str());
+}
+
+void testFieldValues()
+{
+    const std::string filename = temporaryFilename("AsyncLogFields.bin");
+    {
+        AsyncLog log;
+        log.addSink(std::unique_ptr<AsyncLogSink>(new BinaryFileLogSink(filename)));
+        std::string text = "text";
+        HEADLESS_CHECK(log.write(WarningLogLevel, "fields", { { "integer", -42 }, { "real", 0.5 }, { "flag", true },
+                                                              { "string", text }, { nullptr, 7 } }));
+        log.level(WarningLogLevel);
+        HEADLESS_CHECK(!log.isEnabled(InfoLogLevel));
+        HEADLESS_CHECK(!log.write(InfoLogLevel, "filtered"));
+        HEADLESS_CHECK(log.write(ErrorLogLevel, static_cast<const char*>(nullptr), { { "code", 1 } }));
+        HEADLESS_CHECK(log.flush() == 2);
+    }
+
+    size_t recordCount = 0;
+    HEADLESS_CHECK(readBinaryLog(filename, [&](const LogRecord& record) {
+        if (recordCount++ == 0)
+        {
+            HEADLESS_CHECK(record.format() == "Warning: fields integer=-42 real=0.5 flag=true string=text =7");
+            HEADLESS_CHECK(record.formatMessage() == "fields integer=-42 real=0.5 flag=true string=text =7");
+        }
+        else
+        {
+            HEADLESS_CHECK(record.message().empty());
+            HEADLESS_CHECK(record.formatMessage() == " code=1");
+        }
+    }));
+    HEADLESS_CHECK(recordCount == 2);
+    HEADLESS_CHECK(!readBinaryLog(temporaryFilename("AsyncLogMissing.bin"), [](const LogRecord&) {}));
+    std::remove(filename.c_str());
+}
+
+void testApplicationLogSink()
+{
+    loggedMessages().clear();
+    AsyncLog log;
+    log.addSink(std::unique_ptr<AsyncLogSink>(new ApplicationLogSink(FileLogType)));
+    log.write(ErrorLogLevel, "failed", { { "code", 3 } });
+    log.write(InfoLogLevel, "done");
+    HEADLESS_CHECK(loggedMessages().empty());
+
+    // Application::log is called when the log is drained on the main thread.
+    HEADLESS_CHECK(log.flush() == 2);
+
+    std::vector<LoggedMessage>& messages = loggedMessages();
+    if (HEADLESS_CHECK(messages.size() == 2))
+    {
+        HEADLESS_CHECK(messages[0].message == "failed code=3");
+        HEADLESS_CHECK(messages[0].level == ErrorLogLevel);
+        HEADLESS_CHECK(messages[0].type == FileLogType);
+        HEADLESS_CHECK(messages[1].message == "done");
+        HEADLESS_CHECK(messages[1].level == InfoLogLevel);
+    }
+}
+}// namespace
+
+// The headless implementation has no host to log to, so the test records the calls instead.
+void Application::log_raw(const char* message, LogLevels level, LogTypes type)
+{
+    loggedMessages().push_back({ message, level, type });
+}
+
+int main()
+{
+    testConcurrentWritersRoundTrip();
+    testFieldValues();
+    testApplicationLogSink();
+    return headless::test::result("AsyncLogTests");
+}
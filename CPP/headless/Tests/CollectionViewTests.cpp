@@ -0,0 +1,126 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Tests of CollectionView: iteration with range-based for loops, the iterators and the std
+// algorithms, the count read once when the view is created, and prefetch. Build from the root of
+// the repository, with the same include directories as the benchmarks, and run the result:
+//
+//     g++ -std=c++17 -O2 -I CPP/include -I CPP/headless/Core -I CPP/headless/Core/Geometry
+//         CPP/headless/Tests/CollectionViewTests.cpp -o CollectionViewTests -pthread
+//
+// The executable returns 0 if every check passed.
+
+#include <HeadlessCore.h>
+#include <Core/CollectionView.h>
+#include "HeadlessTest.h"
+#include <algorithm>
+#include <vector>
+
+using namespace adsk::core;
+
+namespace {
+
+std::vector<Ptr<Base>> testItems(size_t count)
+{
+    std::vector<Ptr<Base>> res;
+    for (size_t i = 0; i < count; ++i)
+        res.push_back(Point3D::create(static_cast<double>(i), 0.0, 0.0));
+    return res;
+}
+
+void testIteration()
+{
+    std::vector<Ptr<Base>> items = testItems(5);
+    Ptr<ObjectCollection> collection = ObjectCollection::createWithArray(items);
+    CollectionView<ObjectCollection> itemView = view(collection);
+    HEADLESS_CHECK(itemView.size() == items.size() && !itemView.empty());
+    HEADLESS_CHECK(!itemView.isPrefetched());
+    HEADLESS_CHECK(itemView.collection() == collection);
+
+    size_t i = 0;
+    for (Ptr<Base> item : itemView)
+    {
+        HEADLESS_CHECK(i < items.size() && item == items[i]);
+        ++i;
+    }
+    HEADLESS_CHECK(i == items.size());
+
+    // Random access through the iterators and the std algorithms.
+    CollectionView<ObjectCollection>::const_iterator begin = itemView.begin(), end = itemView.end();
+    HEADLESS_CHECK(end - begin == 5);
+    HEADLESS_CHECK(*(begin + 3) == items[3] && begin[4] == items[4] && *(end - 1) == items[4]);
+    HEADLESS_CHECK(begin < end && end > begin && begin <= begin && end >= end);
+    CollectionView<ObjectCollection>::const_iterator it = begin;
+    it += 2;
+    HEADLESS_CHECK(*it++ == items[2] && *it == items[3]);
+    it -= 3;
+    HEADLESS_CHECK(it == begin && *--end == items[4]);
+    HEADLESS_CHECK(std::find(itemView.begin(), itemView.end(), items[2]) - itemView.begin() == 2);
+    HEADLESS_CHECK(std::count_if(itemView.begin(), itemView.end(), [](const Ptr<Base>& item) {
+                       Ptr<Point3D> point = item;
+                       return point && point->x() >= 3.0;
+                   }) == 2);
+    std::vector<Ptr<Base>> copy(itemView.begin(), itemView.end());
+    HEADLESS_CHECK(copy == items);
+
+    // A null collection is an empty view.
+    CollectionView<ObjectCollection> empty = view(Ptr<ObjectCollection>());
+    HEADLESS_CHECK(empty.empty() && empty.begin() == empty.end());
+    empty.prefetch();
+    HEADLESS_CHECK(empty.empty() && !empty.isPrefetched());
+}
+
+void testCountCaching()
+{
+    std::vector<Ptr<Base>> items = testItems(4);
+    Ptr<ObjectCollection> collection = ObjectCollection::createWithArray(items);
+    CollectionView<ObjectCollection> itemView = view(collection);
+
+    // The count is read when the view is created, so items added later are not visited, while
+    // the items themselves are still retrieved from the collection when they are accessed.
+    HEADLESS_CHECK(collection->add(Point3D::create()));
+    HEADLESS_CHECK(collection->removeByIndex(0));
+    HEADLESS_CHECK(itemView.size() == 4 && itemView.end() - itemView.begin() == 4);
+    HEADLESS_CHECK(itemView[0] == items[1]);
+
+    // A new view sees the change.
+    HEADLESS_CHECK(view(collection).size() == 4);
+    HEADLESS_CHECK(view(collection)[3] != items[3]);
+}
+
+void testPrefetch()
+{
+    std::vector<Ptr<Base>> items = testItems(6);
+    Ptr<ObjectCollection> collection = ObjectCollection::createWithArray(items);
+    CollectionView<ObjectCollection> itemView = view(collection);
+    itemView.prefetch();
+    HEADLESS_CHECK(itemView.isPrefetched());
+
+    // Prefetched items are served from the view, pass after pass, even once the collection changes.
+    HEADLESS_CHECK(collection->clear());
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        std::vector<Ptr<Base>> copy(itemView.begin(), itemView.end());
+        HEADLESS_CHECK(copy == items);
+    }
+    HEADLESS_CHECK(itemView.size() == 6);
+
+    // The view keeps its own references to the prefetched items.
+    HEADLESS_CHECK(items[0]->refCount() == 2);
+}
+}// namespace
+
+int main()
+{
+    testIteration();
+    testCountCaching();
+    testPrefetch();
+    return headless::test::result("CollectionViewTests");
+}
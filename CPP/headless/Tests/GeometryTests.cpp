@@ -0,0 +1,470 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Tests of the headless geometry against values known in closed form: lengths, parameters at
+// lengths and curvatures of arcs and of a rational NURBS circle, the capacity and count contract
+// of the getters that write into a buffer supplied by the caller, and the curvatures and point
+// projections of AnalyticSurfaceEvaluator. Build from the root of the repository, with the same
+// include directories as the benchmarks, and run the result:
+//
+//     g++ -std=c++17 -O2 -I CPP/include -I CPP/headless/Core -I CPP/headless/Core/Geometry
+//         CPP/headless/Tests/GeometryTests.cpp -o GeometryTests -pthread
+//
+// The executable returns 0 if every check passed.
+
+#include <HeadlessCore.h>
+#include <Core/Geometry/AnalyticSurfaceEvaluator.h>
+#include "HeadlessTest.h"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace adsk::core;
+
+namespace {
+
+const double pi = 3.14159265358979323846;
+const double tolerance = 1e-9;
+
+Ptr<Arc3D> arc(double radius, double startAngle, double endAngle)
+{
+    return Arc3D::createByCenter(Point3D::create(1.0, 2.0, 3.0), Vector3D::create(0.0, 0.0, 1.0),
+                                 Vector3D::create(1.0, 0.0, 0.0), radius, startAngle, endAngle);
+}
+
+// A quarter of a circle of a radius about the origin in the XY plane, as a rational quadratic NURBS.
+Ptr<NurbsCurve3D> nurbsQuarterCircle(double radius)
+{
+    std::vector<Ptr<Point3D>> controlPoints = { Point3D::create(radius, 0.0, 0.0), Point3D::create(radius, radius, 0.0),
+                                                Point3D::create(0.0, radius, 0.0) };
+    return NurbsCurve3D::createRational(controlPoints, 2, { 0.0, 0.0, 0.0, 1.0, 1.0, 1.0 }, { 1.0, std::sqrt(0.5), 1.0 }, false);
+}
+
+void testArcLengths()
+{
+    Ptr<CurveEvaluator3D> quarter = arc(2.0, 0.0, pi / 2.0)->evaluator();
+    if (!HEADLESS_CHECK(quarter))
+        return;
+    double length = 0.0;
+    HEADLESS_CHECK(quarter->getLengthAtParameter(0.0, pi / 2.0, length));
+    HEADLESS_CHECK_NEAR(length, pi, tolerance);
+    HEADLESS_CHECK(quarter->getLengthAtParameter(pi / 6.0, pi / 3.0, length));
+    HEADLESS_CHECK_NEAR(length, 2.0 * pi / 6.0, tolerance);
+
+    Ptr<CurveEvaluator3D> offset = arc(0.5, pi / 3.0, 3.0 * pi / 2.0)->evaluator();
+    double startParameter = 0.0, endParameter = 0.0;
+    HEADLESS_CHECK(offset->getParameterExtents(startParameter, endParameter));
+    HEADLESS_CHECK_NEAR(startParameter, pi / 3.0, tolerance);
+    HEADLESS_CHECK_NEAR(endParameter, 3.0 * pi / 2.0, tolerance);
+    HEADLESS_CHECK(offset->getLengthAtParameter(startParameter, endParameter, length));
+    HEADLESS_CHECK_NEAR(length, 0.5 * (3.0 * pi / 2.0 - pi / 3.0), tolerance);
+
+    Ptr<CurveEvaluator3D> nurbs = nurbsQuarterCircle(3.0)->evaluator();
+    HEADLESS_CHECK(nurbs->getLengthAtParameter(0.0, 1.0, length));
+    HEADLESS_CHECK_NEAR(length, 3.0 * pi / 2.0, 1e-7);
+}
+
+void testParameterAtLength()
+{
+    Ptr<CurveEvaluator3D> quarter = arc(2.0, 0.0, pi / 2.0)->evaluator();
+    double parameter = 0.0;
+    HEADLESS_CHECK(quarter->getParameterAtLength(0.0, pi / 2.0, parameter));
+    HEADLESS_CHECK_NEAR(parameter, pi / 4.0, tolerance);
+    HEADLESS_CHECK(quarter->getParameterAtLength(pi / 2.0, -pi, parameter));
+    HEADLESS_CHECK_NEAR(parameter, 0.0, tolerance);
+    HEADLESS_CHECK(!quarter->getParameterAtLength(0.0, 2.0 * pi, parameter));
+
+    // The NURBS circle isn't parameterized by angle, but it is symmetric about its middle.
+    Ptr<CurveEvaluator3D> nurbs = nurbsQuarterCircle(3.0)->evaluator();
+    HEADLESS_CHECK(nurbs->getParameterAtLength(0.0, 3.0 * pi / 4.0, parameter));
+    HEADLESS_CHECK_NEAR(parameter, 0.5, 1e-7);
+    Ptr<Point3D> point;
+    HEADLESS_CHECK(nurbs->getParameterAtLength(0.0, 3.0 * pi / 6.0, parameter));
+    HEADLESS_CHECK(nurbs->getPointAtParameter(parameter, point));
+    HEADLESS_CHECK_NEAR(point->x(), 3.0 * std::cos(pi / 6.0), 1e-7);
+    HEADLESS_CHECK_NEAR(point->y(), 3.0 * std::sin(pi / 6.0), 1e-7);
+}
+
+void testCurvature()
+{
+    Ptr<CurveEvaluator3D> evaluator = arc(2.0, 0.0, pi)->evaluator();
+    Ptr<Vector3D> direction;
+    double curvature = 0.0;
+    HEADLESS_CHECK(evaluator->getCurvature(pi / 3.0, direction, curvature));
+    HEADLESS_CHECK_NEAR(curvature, 0.5, tolerance);
+    if (HEADLESS_CHECK(direction))
+    {
+        // The direction points from the curve towards the center of curvature.
+        HEADLESS_CHECK_NEAR(direction->x(), -std::cos(pi / 3.0), tolerance);
+        HEADLESS_CHECK_NEAR(direction->y(), -std::sin(pi / 3.0), tolerance);
+        HEADLESS_CHECK_NEAR(direction->z(), 0.0, tolerance);
+    }
+
+    std::vector<Ptr<Vector3D>> directions;
+    std::vector<double> curvatures;
+    HEADLESS_CHECK(nurbsQuarterCircle(4.0)->evaluator()->getCurvatures({ 0.0, 0.25, 0.5, 1.0 }, directions, curvatures));
+    HEADLESS_CHECK(directions.size() == 4);
+    if (HEADLESS_CHECK(curvatures.size() == 4))
+    {
+        for (double value : curvatures)
+            HEADLESS_CHECK_NEAR(value, 0.25, 1e-9);
+    }
+
+    Ptr<CurveEvaluator3D> line = Line3D::create(Point3D::create(0.0, 0.0, 0.0), Point3D::create(1.0, 1.0, 1.0))->evaluator();
+    HEADLESS_CHECK(line->getCurvature(0.5, direction, curvature));
+    HEADLESS_CHECK_NEAR(curvature, 0.0, tolerance);
+}
+
+void testFlatPoints()
+{
+    Ptr<CurveEvaluator3D> evaluator = arc(2.0, 0.0, pi)->evaluator();
+    const double parameters[] = { 0.0, pi / 2.0, pi };
+    double points[9] = {};
+    HEADLESS_CHECK(evaluator->getPointsAtParameters(parameters, 3, points));
+    const double expected[] = { 3.0, 2.0, 3.0, 1.0, 4.0, 3.0, -1.0, 2.0, 3.0 };
+    for (size_t i = 0; i < 9; ++i)
+        HEADLESS_CHECK_NEAR(points[i], expected[i], tolerance);
+
+    std::vector<double> values;
+    HEADLESS_CHECK(evaluator->getPointsAtParameters(std::vector<double>(parameters, parameters + 3), values));
+    if (HEADLESS_CHECK(values.size() == 9))
+    {
+        for (size_t i = 0; i < 9; ++i)
+            HEADLESS_CHECK_NEAR(values[i], expected[i], tolerance);
+    }
+}
+
+void testBufferGetters()
+{
+    Ptr<NurbsCurve3D> curve = nurbsQuarterCircle(2.0);
+
+    // A buffer that is too small isn't written, but the call succeeds and returns the count needed.
+    double coordinates[9];
+    std::fill(coordinates, coordinates + 9, -1.0);
+    size_t count = 0;
+    HEADLESS_CHECK(curve->getControlPoints(coordinates, 8, count));
+    HEADLESS_CHECK(count == 9);
+    HEADLESS_CHECK(coordinates[0] == -1.0);
+    HEADLESS_CHECK(curve->getControlPoints(nullptr, 0, count));
+    HEADLESS_CHECK(count == 9);
+    HEADLESS_CHECK(curve->getControlPoints(coordinates, 9, count));
+    HEADLESS_CHECK(count == 9);
+    HEADLESS_CHECK(coordinates[0] == 2.0 && coordinates[3] == 2.0 && coordinates[4] == 2.0 && coordinates[7] == 2.0);
+
+    double knots[6];
+    HEADLESS_CHECK(curve->getKnots(knots, 5, count));
+    HEADLESS_CHECK(count == 6);
+    HEADLESS_CHECK(curve->getKnots(knots, 6, count));
+    HEADLESS_CHECK(knots[0] == 0.0 && knots[5] == 1.0);
+
+    // The vector getters grow the array once and reuse it on later calls.
+    std::vector<double> values;
+    HEADLESS_CHECK(curve->getControlPoints(values));
+    HEADLESS_CHECK(values.size() == 9);
+    const double* storage = values.data();
+    HEADLESS_CHECK(curve->getControlPoints(values));
+    HEADLESS_CHECK(values.size() == 9 && values.data() == storage);
+    HEADLESS_CHECK(curve->getKnots(values));
+    HEADLESS_CHECK(values.size() == 6 && values.data() == storage);
+
+    // String getters need room for the terminating null.
+    Ptr<Attribute> attribute = headless::newAttribute("group", "name", "value");
+    char text[8];
+    std::fill(text, text + 8, 'x');
+    size_t length = 0;
+    HEADLESS_CHECK(attribute->getValue(text, 5, length));
+    HEADLESS_CHECK(length == 5);
+    HEADLESS_CHECK(text[0] == 'x');
+    HEADLESS_CHECK(attribute->getValue(text, 6, length));
+    HEADLESS_CHECK(length == 5 && std::string(text) == "value");
+    std::string name;
+    HEADLESS_CHECK(attribute->getName(name));
+    HEADLESS_CHECK(name == "name");
+
+    // The collection getter writes the items once the buffer is large enough.
+    Ptr<ObjectCollection> collection = ObjectCollection::create();
+    collection->add(Point3D::create(1.0, 0.0, 0.0));
+    collection->add(Point3D::create(2.0, 0.0, 0.0));
+    std::vector<Ptr<Base>> items;
+    HEADLESS_CHECK(collection->asArray(items));
+    if (HEADLESS_CHECK(items.size() == 2))
+    {
+        Ptr<Point3D> second = items[1];
+        HEADLESS_CHECK(second && second->x() == 2.0);
+    }
+}
+// Returns the difference between two angles, wrapped to the range -pi to pi.
+double angleDifference(double a, double b)
+{
+    return std::remainder(a - b, 2.0 * pi);
+}
+
+// Evaluates a grid of parameters, projects the points back and checks that the parameters are
+// recovered, both for the points on the surface and for points moved off it along the normal.
+template <class Evaluator>
+void checkProjection(const Evaluator& evaluator, const std::vector<double>& parameters, double offset, bool isUPeriodic, bool isVPeriodic)
+{
+    size_t count = parameters.size() / 2;
+    std::vector<double> points(3 * count), normals(3 * count), offsetPoints(3 * count), projected(2 * count);
+    evaluator.getPointsAtParameters(parameters.data(), count, points.data());
+    evaluator.getNormalsAtParameters(parameters.data(), count, normals.data());
+    for (size_t i = 0; i < 3 * count; ++i)
+        offsetPoints[i] = points[i] + offset * normals[i];
+
+    for (const std::vector<double>* source : { &points, &offsetPoints })
+    {
+        evaluator.getParametersAtPoints(source->data(), count, projected.data());
+        for (size_t i = 0; i < count; ++i)
+        {
+            double du = projected[2 * i] - parameters[2 * i];
+            double dv = projected[2 * i + 1] - parameters[2 * i + 1];
+            HEADLESS_CHECK_NEAR(isUPeriodic ? angleDifference(projected[2 * i], parameters[2 * i]) : du, 0.0, 1e-9);
+            HEADLESS_CHECK_NEAR(isVPeriodic ? angleDifference(projected[2 * i + 1], parameters[2 * i + 1]) : dv, 0.0, 1e-9);
+        }
+    }
+}
+
+// Parameters on a grid, with u going all the way around and v taken from a list.
+std::vector<double> parameterGrid(const std::vector<double>& vValues)
+{
+    std::vector<double> res;
+    for (int i = 0; i < 12; ++i)
+    {
+        for (double v : vValues)
+        {
+            res.push_back(0.1 + i * pi / 6.0);
+            res.push_back(v);
+        }
+    }
+    return res;
+}
+
+void testSphereCurvature()
+{
+    AnalyticSurfaceEvaluator<SphereSurfaceType> evaluator(Sphere::create(Point3D::create(1.0, -2.0, 3.0), 2.5));
+    if (!HEADLESS_CHECK(evaluator.isValid()))
+        return;
+    std::vector<double> parameters = parameterGrid({ -1.2, -0.4, 0.0, 0.7, 1.3 });
+    size_t count = parameters.size() / 2;
+    std::vector<double> points(3 * count), normals(3 * count), maxCurvatures(count), minCurvatures(count);
+    evaluator.getPointsAtParameters(parameters.data(), count, points.data());
+    evaluator.getNormalsAtPoints(points.data(), count, normals.data());
+    evaluator.getCurvaturesAtPoints(points.data(), count, maxCurvatures.data(), minCurvatures.data());
+    for (size_t i = 0; i < count; ++i)
+    {
+        // The normal points out of the sphere, so the sphere curves away from it and both curvatures are 1/r.
+        HEADLESS_CHECK_NEAR(points[3 * i] - 1.0, 2.5 * normals[3 * i], tolerance);
+        HEADLESS_CHECK_NEAR(points[3 * i + 1] + 2.0, 2.5 * normals[3 * i + 1], tolerance);
+        HEADLESS_CHECK_NEAR(points[3 * i + 2] - 3.0, 2.5 * normals[3 * i + 2], tolerance);
+        HEADLESS_CHECK_NEAR(maxCurvatures[i], 0.4, tolerance);
+        HEADLESS_CHECK_NEAR(minCurvatures[i], 0.4, tolerance);
+    }
+    checkProjection(evaluator, parameters, 0.5, true, false);
+    checkProjection(evaluator, parameters, -0.5, true, false);
+
+    HEADLESS_CHECK(!AnalyticSurfaceEvaluator<SphereSurfaceType>(Ptr<Sphere>()).isValid());
+
+    // A uniform scale keeps the surface a sphere, and the evaluator follows its new data.
+    Ptr<Sphere> sphere = Sphere::create(Point3D::create(1.0, 0.0, 0.0), 1.0);
+    Ptr<Matrix3D> matrix = Matrix3D::create();
+    for (int i = 0; i < 3; ++i)
+        matrix->setCell(i, i, 2.0);
+    HEADLESS_CHECK(sphere->transformBy(matrix));
+    HEADLESS_CHECK_NEAR(sphere->radius(), 2.0, tolerance);
+    HEADLESS_CHECK_NEAR(sphere->origin()->x(), 2.0, tolerance);
+    double maxCurvature = 0.0, minCurvature = 0.0;
+    const double point[] = { 4.0, 0.0, 0.0 };
+    AnalyticSurfaceEvaluator<SphereSurfaceType>(sphere).getCurvaturesAtPoints(point, 1, &maxCurvature, &minCurvature);
+    HEADLESS_CHECK_NEAR(maxCurvature, 0.5, tolerance);
+    matrix->setCell(0, 0, 3.0);
+    HEADLESS_CHECK(!sphere->transformBy(matrix));
+    HEADLESS_CHECK_NEAR(sphere->radius(), 2.0, tolerance);
+}
+
+void testTorusCurvatures()
+{
+    const double majorRadius = 5.0, minorRadius = 1.0;
+    Ptr<Torus> torus = Torus::create(Point3D::create(0.5, 0.0, -1.0), Vector3D::create(0.0, 1.0, 1.0), majorRadius, minorRadius);
+    AnalyticSurfaceEvaluator<TorusSurfaceType> evaluator(torus);
+    if (!HEADLESS_CHECK(evaluator.isValid()))
+        return;
+
+    // On the outer equator both principal directions curve away from the normal. On the inner
+    // equator the ring around the axis curves towards it, so that curvature is negative, and on
+    // the top circle the ring direction is straight across the normal.
+    const double parameters[] = { 0.3, 0.0, 2.0, pi, 4.0, pi / 2.0 };
+    const double expectedMax[] = { 1.0 / minorRadius, 1.0 / minorRadius, 1.0 / minorRadius };
+    const double expectedMin[] = { 1.0 / (majorRadius + minorRadius), -1.0 / (majorRadius - minorRadius), 0.0 };
+    double points[9], maxCurvatures[3], minCurvatures[3];
+    evaluator.getPointsAtParameters(parameters, 3, points);
+    evaluator.getCurvaturesAtPoints(points, 3, maxCurvatures, minCurvatures);
+    for (size_t i = 0; i < 3; ++i)
+    {
+        HEADLESS_CHECK_NEAR(maxCurvatures[i], expectedMax[i], tolerance);
+        HEADLESS_CHECK_NEAR(minCurvatures[i], expectedMin[i], tolerance);
+    }
+
+    // The outer equator is majorRadius + minorRadius from the axis.
+    double normal[3];
+    evaluator.getNormalsAtParameters(parameters, 1, normal);
+    HEADLESS_CHECK_NEAR(normal[1] + normal[2], 0.0, tolerance);
+    HEADLESS_CHECK_NEAR(std::hypot(points[0] - 0.5, std::hypot(points[1], points[2] + 1.0)), majorRadius + minorRadius, tolerance);
+
+    checkProjection(evaluator, parameterGrid({ 0.0, 1.0, 2.5, pi, 4.0, 5.5 }), 0.4, true, true);
+    checkProjection(evaluator, parameterGrid({ 0.0, 1.0, 2.5, pi, 4.0, 5.5 }), -0.4, true, true);
+}
+
+void testConeProjection()
+{
+    const double radius = 2.0, halfAngle = pi / 6.0;
+    Ptr<Cone> cone = Cone::create(Point3D::create(0.0, 1.0, 0.0), Vector3D::create(1.0, 0.0, 0.0), radius, halfAngle);
+    AnalyticSurfaceEvaluator<ConeSurfaceType> evaluator(cone);
+    if (!HEADLESS_CHECK(evaluator.isValid()))
+        return;
+    std::vector<double> parameters = parameterGrid({ -2.0, 0.0, 1.5, 4.0 });
+    checkProjection(evaluator, parameters, 0.3, true, false);
+    checkProjection(evaluator, parameters, -0.3, true, false);
+
+    // A point beyond the apex projects onto the apex.
+    double apexSide[3] = { -radius / std::tan(halfAngle) - 5.0, 1.0, 0.0 };
+    double uv[2], apex[3];
+    evaluator.getParametersAtPoints(apexSide, 1, uv);
+    evaluator.getPointsAtParameters(uv, 1, apex);
+    HEADLESS_CHECK_NEAR(apex[0], -radius / std::tan(halfAngle), tolerance);
+    HEADLESS_CHECK_NEAR(apex[1], 1.0, tolerance);
+    HEADLESS_CHECK_NEAR(apex[2], 0.0, tolerance);
+}
+
+void testEllipticalProjection()
+{
+    Ptr<EllipticalCylinder> cylinder = EllipticalCylinder::create(Point3D::create(1.0, 2.0, 3.0), Vector3D::create(0.0, 0.0, 2.0),
+                                                                  Vector3D::create(1.0, 1.0, 0.0), 3.0, 1.0);
+    AnalyticSurfaceEvaluator<EllipticalCylinderSurfaceType> cylinderEvaluator(cylinder);
+    if (HEADLESS_CHECK(cylinderEvaluator.isValid()))
+    {
+        std::vector<double> parameters = parameterGrid({ -1.0, 0.0, 2.5 });
+        checkProjection(cylinderEvaluator, parameters, 0.2, true, false);
+        checkProjection(cylinderEvaluator, parameters, -0.2, true, false);
+        checkProjection(cylinderEvaluator, parameters, 4.0, true, false);
+    }
+
+    Ptr<EllipticalCone> cone = EllipticalCone::create(Point3D::create(0.0, 0.0, 0.0), Vector3D::create(0.0, 0.0, 1.0),
+                                                      Vector3D::create(0.0, 1.0, 0.0), 2.0, 1.0, pi / 8.0);
+    AnalyticSurfaceEvaluator<EllipticalConeSurfaceType> coneEvaluator(cone);
+    if (HEADLESS_CHECK(coneEvaluator.isValid()))
+    {
+        std::vector<double> parameters = parameterGrid({ -1.0, 0.0, 3.0 });
+        checkProjection(coneEvaluator, parameters, 0.0, true, false);
+        checkProjection(coneEvaluator, parameters, 0.05, true, false);
+        checkProjection(coneEvaluator, parameters, -0.05, true, false);
+    }
+}
+
+void testEllipseFootPoint()
+{
+    // The foot point of a point moved along the normal of the ellipse is the point it was moved
+    // from, as long as it stays within the radius of curvature, b^2 / a at the ends of the major axis.
+    const double a = 3.0, b = 1.0;
+    for (int i = 0; i < 24; ++i)
+    {
+        double u = 0.05 + i * pi / 12.0;
+        double nx = b * std::cos(u), ny = a * std::sin(u);
+        double scale = 1.0 / std::hypot(nx, ny);
+        for (double offset : { -0.3, 0.0, 0.3, 10.0 })
+        {
+            double x = a * std::cos(u) + offset * nx * scale;
+            double y = b * std::sin(u) + offset * ny * scale;
+            HEADLESS_CHECK_NEAR(angleDifference(analytic_detail::closestEllipseAngle(a, b, x, y), u), 0.0, 1e-12);
+        }
+    }
+
+    // Points on the axes project to the ends of the axes, and a circle projects radially.
+    HEADLESS_CHECK_NEAR(analytic_detail::closestEllipseAngle(a, b, 5.0, 0.0), 0.0, 1e-12);
+    HEADLESS_CHECK_NEAR(analytic_detail::closestEllipseAngle(a, b, 0.0, -2.0), 1.5 * pi, 1e-12);
+    HEADLESS_CHECK_NEAR(analytic_detail::closestEllipseAngle(2.0, 2.0, -1.0, 1.0), 0.75 * pi, 1e-12);
+
+    // A point on the major axis inside the evolute, |x| < (a^2 - b^2) / a, is closest to a point
+    // off the axis, cos u = a x / (a^2 - b^2), and not to the near vertex.
+    const double onAxis = std::acos(2.0 * 0.5 / 3.0);
+    HEADLESS_CHECK_NEAR(analytic_detail::closestEllipseAngle(2.0, 1.0, 0.5, 0.0), onAxis, 1e-12);
+    HEADLESS_CHECK_NEAR(analytic_detail::closestEllipseAngle(2.0, 1.0, -0.5, 0.0), pi - onAxis, 1e-12);
+    HEADLESS_CHECK_NEAR(analytic_detail::closestEllipseAngle(2.0, 1.0, 0.0, 0.0), 0.5 * pi, 1e-12);
+
+    Ptr<EllipticalCylinder> cylinder = EllipticalCylinder::create(Point3D::create(), Vector3D::create(0.0, 0.0, 1.0),
+                                                                  Vector3D::create(1.0, 0.0, 0.0), 2.0, 1.0);
+    AnalyticSurfaceEvaluator<EllipticalCylinderSurfaceType> evaluator(cylinder);
+    const double point[] = { 0.5, 0.0, 3.0 };
+    double parameters[2], closest[3];
+    evaluator.getParametersAtPoints(point, 1, parameters);
+    evaluator.getPointsAtParameters(parameters, 1, closest);
+    HEADLESS_CHECK_NEAR(std::fabs(angleDifference(parameters[0], 0.0)), onAxis, 1e-12);
+    HEADLESS_CHECK_NEAR(parameters[1], 3.0, tolerance);
+    HEADLESS_CHECK_NEAR(std::hypot(closest[0] - 0.5, closest[1]), std::sqrt(1.0 - 0.5 * 0.5 / 3.0), 1e-12);
+}
+
+void testCurvatureSigns()
+{
+    // A convex surface curves away from its outward normal, so its curvatures are positive and a
+    // straight direction, such as along the axis of a cylinder or cone, has zero curvature.
+    const double a = 3.0, b = 1.0;
+    AnalyticSurfaceEvaluator<EllipticalCylinderSurfaceType> cylinder(EllipticalCylinder::create(Point3D::create(), Vector3D::create(0.0, 0.0, 1.0),
+                                                                                               Vector3D::create(1.0, 0.0, 0.0), a, b));
+    const double cylinderPoints[] = { a, 0.0, 1.0, 0.0, b, -1.0 };
+    double maxCurvatures[2], minCurvatures[2];
+    cylinder.getCurvaturesAtPoints(cylinderPoints, 2, maxCurvatures, minCurvatures);
+    HEADLESS_CHECK_NEAR(maxCurvatures[0], a / (b * b), tolerance);
+    HEADLESS_CHECK_NEAR(maxCurvatures[1], b / (a * a), tolerance);
+    HEADLESS_CHECK_NEAR(minCurvatures[0], 0.0, tolerance);
+    HEADLESS_CHECK_NEAR(minCurvatures[1], 0.0, tolerance);
+
+    // An elliptical cone with equal radii is a circular cone, so both evaluators must agree.
+    const double radius = 1.5, halfAngle = pi / 5.0;
+    AnalyticSurfaceEvaluator<ConeSurfaceType> cone(Cone::create(Point3D::create(), Vector3D::create(0.0, 0.0, 1.0), radius, halfAngle));
+    AnalyticSurfaceEvaluator<EllipticalConeSurfaceType> ellipticalCone(EllipticalCone::create(Point3D::create(), Vector3D::create(0.0, 0.0, 1.0),
+                                                                                              Vector3D::create(1.0, 0.0, 0.0), radius, radius, halfAngle));
+    const double conePoints[] = { radius, 0.0, 0.0, 0.0, -(radius + std::tan(halfAngle)), 1.0 };
+    double ellipticalMax[2], ellipticalMin[2], normals[6], ellipticalNormals[6];
+    cone.getCurvaturesAtPoints(conePoints, 2, maxCurvatures, minCurvatures);
+    ellipticalCone.getCurvaturesAtPoints(conePoints, 2, ellipticalMax, ellipticalMin);
+    cone.getNormalsAtPoints(conePoints, 2, normals);
+    ellipticalCone.getNormalsAtPoints(conePoints, 2, ellipticalNormals);
+    HEADLESS_CHECK_NEAR(maxCurvatures[0], std::cos(halfAngle) / radius, tolerance);
+    HEADLESS_CHECK_NEAR(maxCurvatures[1], std::cos(halfAngle) / (radius + std::tan(halfAngle)), tolerance);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        HEADLESS_CHECK_NEAR(minCurvatures[i], 0.0, tolerance);
+        HEADLESS_CHECK_NEAR(ellipticalMax[i], maxCurvatures[i], 1e-9);
+        HEADLESS_CHECK_NEAR(ellipticalMin[i], minCurvatures[i], 1e-9);
+    }
+    for (size_t i = 0; i < 6; ++i)
+        HEADLESS_CHECK_NEAR(ellipticalNormals[i], normals[i], 1e-9);
+
+    // The cone opens along its axis, so its normal leans back against the axis.
+    HEADLESS_CHECK_NEAR(normals[0], std::cos(halfAngle), tolerance);
+    HEADLESS_CHECK_NEAR(normals[2], -std::sin(halfAngle), tolerance);
+}
+}// namespace
+
+int main()
+{
+    testArcLengths();
+    testParameterAtLength();
+    testCurvature();
+    testFlatPoints();
+    testBufferGetters();
+    testSphereCurvature();
+    testTorusCurvatures();
+    testConeProjection();
+    testEllipticalProjection();
+    testEllipseFootPoint();
+    testCurvatureSigns();
+    return headless::test::result("GeometryTests");
+}
@@ -0,0 +1,67 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+
+// Checks shared by the headless tests. A check that fails prints its file, line and expression
+// and carries on, so one run reports every failure. Checks can be made from any thread. Each test
+// executable returns headless::test::result from main, which is 0 only if every check passed.
+
+namespace adsk { namespace core { namespace headless { namespace test {
+
+inline std::atomic<int>& failureCount()
+{
+    static std::atomic<int> count(0);
+    return count;
+}
+
+inline bool check(bool condition, const char* expression, const char* file, int line)
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "%s(%d): check failed: %s\n", file, line, expression);
+        ++failureCount();
+    }
+    return condition;
+}
+
+inline bool checkNear(double actual, double expected, double tolerance, const char* expression, const char* file, int line)
+{
+    bool res = std::fabs(actual - expected) <= tolerance;
+    if (!res)
+    {
+        std::fprintf(stderr, "%s(%d): check failed: %s is %.17g, expected %.17g within %g\n",
+                     file, line, expression, actual, expected, tolerance);
+        ++failureCount();
+    }
+    return res;
+}
+
+/// Prints the result of the test executable and returns the exit code for main.
+inline int result(const char* name)
+{
+    int failures = failureCount().load();
+    if (failures == 0)
+        std::printf("%s: all checks passed\n", name);
+    else
+        std::printf("%s: %d checks failed\n", name, failures);
+    return failures == 0 ? 0 : 1;
+}
+}// namespace test
+}// namespace headless
+}// namespace core
+}// namespace adsk
+
+#define HEADLESS_CHECK(condition) ::adsk::core::headless::test::check(!!(condition), #condition, __FILE__, __LINE__)
+#define HEADLESS_CHECK_NEAR(actual, expected, tolerance) \
+    ::adsk::core::headless::test::checkNear((actual), (expected), (tolerance), #actual, __FILE__, __LINE__)
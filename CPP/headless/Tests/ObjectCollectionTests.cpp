@@ -0,0 +1,124 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Tests of ObjectCollection: creating a collection from a range in a single call, including ranges
+// that hold null items, and the bulk addArray and asArray methods. Build from the root of the
+// repository, with the same include directories as the benchmarks, and run the result:
+//
+//     g++ -std=c++17 -O2 -I CPP/include -I CPP/headless/Core -I CPP/headless/Core/Geometry
+//         CPP/headless/Tests/ObjectCollectionTests.cpp -o ObjectCollectionTests -pthread
+//
+// The executable returns 0 if every check passed.
+
+#include <HeadlessCore.h>
+#include "HeadlessTest.h"
+#include <list>
+#include <vector>
+
+using namespace adsk::core;
+
+namespace {
+
+std::vector<Ptr<Point3D>> testPoints(size_t count)
+{
+    std::vector<Ptr<Point3D>> res;
+    for (size_t i = 0; i < count; ++i)
+        res.push_back(Point3D::create(static_cast<double>(i), 0.0, 0.0));
+    return res;
+}
+
+// Checks that a collection holds the points in order, with the null items left out.
+void checkItems(const Ptr<ObjectCollection>& collection, const std::vector<Ptr<Point3D>>& points)
+{
+    std::vector<Ptr<Point3D>> expected;
+    for (const Ptr<Point3D>& point : points)
+    {
+        if (point)
+            expected.push_back(point);
+    }
+    if (!HEADLESS_CHECK(collection) || !HEADLESS_CHECK(collection->count() == expected.size()))
+        return;
+    for (size_t i = 0; i < expected.size(); ++i)
+        HEADLESS_CHECK(collection->item(i).get() == expected[i].get());
+}
+
+void testCreateFromRange()
+{
+    std::vector<Ptr<Point3D>> points = testPoints(5);
+    checkItems(ObjectCollection::create(points), points);
+    checkItems(ObjectCollection::create(points.begin(), points.begin()), {});
+
+    // A null item is skipped and the others are still added.
+    points[2] = nullptr;
+    checkItems(ObjectCollection::create(points), points);
+    checkItems(ObjectCollection::create(points.begin(), points.end()), points);
+    std::list<Ptr<Point3D>> list(points.begin(), points.end());
+    checkItems(ObjectCollection::create(list), points);
+
+    // Ranges of raw pointers, which the collection takes the references of.
+    list.clear();
+    std::vector<Point3D*> raw;
+    for (const Ptr<Point3D>& point : points)
+    {
+        if (point)
+            point->addref();
+        raw.push_back(point.get());
+    }
+    checkItems(ObjectCollection::create(raw.begin(), raw.end()), points);
+    for (const Ptr<Point3D>& point : points)
+        HEADLESS_CHECK(!point || point->refCount() == 1);
+}
+
+void testNullItemsInArrays()
+{
+    std::vector<Ptr<Point3D>> points = testPoints(3);
+    std::vector<Ptr<Base>> items(points.begin(), points.end());
+    checkItems(ObjectCollection::createWithArray(items), points);
+
+    // The array methods reject a null item rather than dropping it.
+    items[1] = nullptr;
+    HEADLESS_CHECK(!ObjectCollection::createWithArray(items));
+    Ptr<ObjectCollection> collection = ObjectCollection::create();
+    HEADLESS_CHECK(collection->add(points[0]));
+    HEADLESS_CHECK(!collection->addArray(items));
+    checkItems(collection, { points[0] });
+    HEADLESS_CHECK(!collection->add(nullptr));
+}
+
+void testArrays()
+{
+    std::vector<Ptr<Point3D>> points = testPoints(20);
+    Ptr<ObjectCollection> collection = ObjectCollection::create();
+    std::vector<Ptr<Base>> items(points.begin(), points.begin() + 12);
+    HEADLESS_CHECK(collection->addArray(items));
+    items.assign(points.begin() + 12, points.end());
+    HEADLESS_CHECK(collection->addArray(items));
+    items.clear();
+    checkItems(collection, points);
+
+    // The caller's array is filled and reused, and the collection keeps its own references.
+    std::vector<Ptr<Base>> array(3);
+    HEADLESS_CHECK(collection->asArray(array));
+    HEADLESS_CHECK(array.size() == points.size());
+    for (size_t i = 0; i < points.size() && i < array.size(); ++i)
+        HEADLESS_CHECK(array[i].get() == points[i].get() && points[i]->refCount() == 3);
+    array.clear();
+    HEADLESS_CHECK(points[0]->refCount() == 2);
+    HEADLESS_CHECK(collection->asArray().size() == points.size());
+}
+}// namespace
+
+int main()
+{
+    testCreateFromRange();
+    testNullItemsInArrays();
+    testArrays();
+    return headless::test::result("ObjectCollectionTests");
+}
@@ -0,0 +1,196 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Tests of ObjectSet: insertion order, removing and adding objects again, across the compaction of
+// the removed slots, the set operations and the round trip through ObjectCollection. Build from
+// the root of the repository, with the same include directories as the benchmarks, and run the
+// result:
+//
+//     g++ -std=c++17 -O2 -I CPP/include -I CPP/headless/Core -I CPP/headless/Core/Geometry
+//         CPP/headless/Tests/ObjectSetTests.cpp -o ObjectSetTests -pthread
+//
+// The executable returns 0 if every check passed.
+
+#include <HeadlessCore.h>
+#include <Core/Application/ObjectSet.h>
+#include "HeadlessTest.h"
+#include <vector>
+
+using namespace adsk::core;
+
+namespace {
+
+std::vector<Ptr<Point3D>> testPoints(size_t count)
+{
+    std::vector<Ptr<Point3D>> res;
+    for (size_t i = 0; i < count; ++i)
+        res.push_back(Point3D::create(static_cast<double>(i), 0.0, 0.0));
+    return res;
+}
+
+// Returns the points at a list of indices.
+std::vector<Ptr<Point3D>> pick(const std::vector<Ptr<Point3D>>& points, const std::vector<size_t>& indices)
+{
+    std::vector<Ptr<Point3D>> res;
+    for (size_t index : indices)
+        res.push_back(points[index]);
+    return res;
+}
+
+// Checks that a set holds exactly the objects, in order, both by iterating it and by asArray.
+void checkOrder(const ObjectSet<Point3D>& set, const std::vector<Ptr<Point3D>>& expected)
+{
+    HEADLESS_CHECK(set.size() == expected.size());
+    HEADLESS_CHECK(set.empty() == expected.empty());
+    size_t i = 0;
+    for (const Ptr<Point3D>& object : set)
+    {
+        HEADLESS_CHECK(i < expected.size() && object == expected[i]);
+        ++i;
+    }
+    HEADLESS_CHECK(i == expected.size());
+    HEADLESS_CHECK(set.asArray() == expected);
+    for (const Ptr<Point3D>& object : expected)
+        HEADLESS_CHECK(set.contains(object));
+}
+
+void testInsertionOrder()
+{
+    std::vector<Ptr<Point3D>> points = testPoints(4);
+    ObjectSet<Point3D> set;
+    HEADLESS_CHECK(set.insert(points[2]));
+    HEADLESS_CHECK(set.insert(points[0]));
+    HEADLESS_CHECK(!set.insert(points[2]));
+    HEADLESS_CHECK(!set.insert(Ptr<Point3D>()));
+    HEADLESS_CHECK(set.insert(pick(points, { 3, 0, 1, 3 })) == 2);
+    checkOrder(set, pick(points, { 2, 0, 3, 1 }));
+
+    // Objects are compared by identity, so an equal point is a different object.
+    HEADLESS_CHECK(set.insert(Point3D::create(0.0, 0.0, 0.0)));
+    HEADLESS_CHECK(set.size() == 5);
+
+    set.clear();
+    checkOrder(set, {});
+    HEADLESS_CHECK(!set.contains(points[0]));
+}
+
+void testRemoveAndAddAgain()
+{
+    std::vector<Ptr<Point3D>> points = testPoints(10);
+    ObjectSet<Point3D> set(points);
+    HEADLESS_CHECK(set.remove(points[3]));
+    HEADLESS_CHECK(!set.remove(points[3]));
+    HEADLESS_CHECK(!set.contains(points[3]));
+
+    // The set releases its reference as soon as an object is removed.
+    HEADLESS_CHECK(points[3]->refCount() == 1);
+    HEADLESS_CHECK(points[4]->refCount() == 2);
+
+    // An object that is added again goes to the end.
+    HEADLESS_CHECK(set.insert(points[3]));
+    checkOrder(set, pick(points, { 0, 1, 2, 4, 5, 6, 7, 8, 9, 3 }));
+}
+
+void testCompaction()
+{
+    // The removed slots are dropped when they make up more than half of the storage, which
+    // happens at the sixth removal of ten objects. Order, membership and the positions of
+    // objects added later must not change across it.
+    std::vector<Ptr<Point3D>> points = testPoints(12);
+    ObjectSet<Point3D> set(pick(points, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+    for (size_t index : { 8, 0, 2, 4, 6 })
+        HEADLESS_CHECK(set.remove(points[index]));
+    checkOrder(set, pick(points, { 1, 3, 5, 7, 9 }));
+    HEADLESS_CHECK(set.remove(points[1]));
+    checkOrder(set, pick(points, { 3, 5, 7, 9 }));
+
+    HEADLESS_CHECK(set.insert(points[10]));
+    HEADLESS_CHECK(set.insert(points[0]));
+    HEADLESS_CHECK(set.remove(points[7]));
+    HEADLESS_CHECK(set.insert(points[11]));
+    checkOrder(set, pick(points, { 3, 5, 9, 10, 0, 11 }));
+    for (size_t index : { 1, 2, 4, 6, 7, 8 })
+        HEADLESS_CHECK(!set.contains(points[index]));
+
+    // Removing every object, in an order that compacts several times, leaves an empty set that
+    // can be used again.
+    for (size_t index : { 9, 3, 11, 0, 5, 10 })
+        HEADLESS_CHECK(set.remove(points[index]));
+    checkOrder(set, {});
+    HEADLESS_CHECK(set.insert(points[6]));
+    checkOrder(set, pick(points, { 6 }));
+    for (const Ptr<Point3D>& point : points)
+        HEADLESS_CHECK(point->refCount() == (point == points[6] ? 2 : 1));
+}
+
+void testSetOperations()
+{
+    std::vector<Ptr<Point3D>> points = testPoints(6);
+    ObjectSet<Point3D> a(pick(points, { 0, 1, 2, 3 }));
+    ObjectSet<Point3D> b(pick(points, { 4, 3, 1, 5 }));
+
+    checkOrder(a | b, pick(points, { 0, 1, 2, 3, 4, 5 }));
+    checkOrder(b | a, pick(points, { 4, 3, 1, 5, 0, 2 }));
+    checkOrder(a & b, pick(points, { 1, 3 }));
+    checkOrder(b & a, pick(points, { 3, 1 }));
+    checkOrder(a - b, pick(points, { 0, 2 }));
+    checkOrder(b - a, pick(points, { 4, 5 }));
+
+    ObjectSet<Point3D> set(a);
+    checkOrder(set.unite(b), pick(points, { 0, 1, 2, 3, 4, 5 }));
+    set = a;
+    checkOrder(set.intersect(b), pick(points, { 1, 3 }));
+    set = a;
+    checkOrder(set.subtract(b), pick(points, { 0, 2 }));
+
+    // Operations of a set with itself and with an empty set.
+    set = a;
+    checkOrder(set.unite(set), pick(points, { 0, 1, 2, 3 }));
+    checkOrder(set.intersect(set), pick(points, { 0, 1, 2, 3 }));
+    checkOrder(set.subtract(set), {});
+    ObjectSet<Point3D> empty;
+    checkOrder(a | empty, pick(points, { 0, 1, 2, 3 }));
+    checkOrder(a & empty, {});
+    checkOrder(a - empty, pick(points, { 0, 1, 2, 3 }));
+    checkOrder(empty - a, {});
+}
+
+void testObjectCollectionRoundTrip()
+{
+    std::vector<Ptr<Point3D>> points = testPoints(8);
+    ObjectSet<Point3D> set(points);
+    HEADLESS_CHECK(set.remove(points[0]));
+    HEADLESS_CHECK(set.remove(points[5]));
+    HEADLESS_CHECK(set.insert(points[0]));
+    std::vector<Ptr<Point3D>> expected = pick(points, { 1, 2, 3, 4, 6, 7, 0 });
+
+    Ptr<ObjectCollection> collection = set.toObjectCollection();
+    if (!HEADLESS_CHECK(collection) || !HEADLESS_CHECK(collection->count() == expected.size()))
+        return;
+    for (size_t i = 0; i < expected.size(); ++i)
+        HEADLESS_CHECK(collection->item(i).get() == expected[i].get());
+
+    // Duplicates in a collection are dropped when it is turned back into a set.
+    HEADLESS_CHECK(collection->add(points[2]));
+    checkOrder(ObjectSet<Point3D>(collection), expected);
+    checkOrder(ObjectSet<Point3D>(Ptr<ObjectCollection>()), {});
+    HEADLESS_CHECK(ObjectSet<Point3D>().toObjectCollection()->count() == 0);
+}
+}// namespace
+
+int main()
+{
+    testInsertionOrder();
+    testRemoveAndAddAgain();
+    testCompaction();
+    testSetOperations();
+    testObjectCollectionRoundTrip();
+    return headless::test::result("ObjectSetTests");
+}
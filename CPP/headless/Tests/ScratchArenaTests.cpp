@@ -0,0 +1,223 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Tests of ScratchArena and ScratchArray: the inline and arena storage of ScratchArray, markers
+// released in reverse order, growing the arena by blocks, nested ScratchArena::Scope and the
+// separate arena of each thread. Build from the root of the repository, with the same include
+// directories as the benchmarks, and run the result:
+//
+//     g++ -std=c++17 -O2 -I CPP/include -I CPP/headless/Core -I CPP/headless/Core/Geometry
+//         CPP/headless/Tests/ScratchArenaTests.cpp -o ScratchArenaTests -pthread
+//
+// The executable returns 0 if every check passed.
+
+#include <Core/ScratchArena.h>
+#include "HeadlessTest.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace adsk::core;
+
+namespace {
+
+// Indicates if a pointer is inside an object, which is where ScratchArray keeps inline elements.
+template <class T, class Object>
+bool isInside(const T* pointer, const Object& object)
+{
+    const unsigned char* begin = reinterpret_cast<const unsigned char*>(&object);
+    const unsigned char* address = reinterpret_cast<const unsigned char*>(pointer);
+    return address >= begin && address < begin + sizeof(Object);
+}
+
+bool isAligned(const void* pointer, size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+
+bool isSameMarker(const ScratchArena::Marker& a, const ScratchArena::Marker& b)
+{
+    return a.block == b.block && a.used == b.used;
+}
+
+void testScratchArray()
+{
+    ScratchArena arena(1024);
+    ScratchArena::Scope scope(arena);
+
+    // Give the arena its first block, after which releasing returns it to the same marker.
+    ScratchArena::Marker empty = arena.mark();
+    HEADLESS_CHECK(arena.allocate(8, 8));
+    arena.release(empty);
+    ScratchArena::Marker start = arena.mark();
+
+    {
+        ScratchArray<double*> none(0);
+        HEADLESS_CHECK(none.get() == nullptr && static_cast<double**>(none) == nullptr);
+    }
+
+    // Up to 16 elements are stored in the array itself and don't touch the arena.
+    {
+        ScratchArray<double*> small(16);
+        HEADLESS_CHECK(small.get() && isInside(small.get(), small));
+        for (size_t i = 0; i < 16; ++i)
+            small[i] = nullptr;
+        HEADLESS_CHECK(isSameMarker(arena.mark(), start));
+    }
+
+    // Larger arrays come from the current arena and are returned to it when they are destroyed.
+    double* heapData = nullptr;
+    {
+        ScratchArray<double, 16> large(17);
+        heapData = large.get();
+        HEADLESS_CHECK(heapData && !isInside(heapData, large) && isAligned(heapData, alignof(double)));
+        for (size_t i = 0; i < 17; ++i)
+            large[i] = static_cast<double>(i);
+        HEADLESS_CHECK(!isSameMarker(arena.mark(), start));
+    }
+    HEADLESS_CHECK(isSameMarker(arena.mark(), start));
+
+    // The memory is reused by the next array.
+    {
+        ScratchArray<double, 16> again(20);
+        HEADLESS_CHECK(again.get() == heapData);
+
+        // Arrays nested in scopes release in reverse order.
+        {
+            ScratchArray<double, 16> inner(100);
+            HEADLESS_CHECK(inner.get() != again.get());
+        }
+        ScratchArray<double, 16> next(100);
+        HEADLESS_CHECK(next.get() > again.get());
+    }
+    HEADLESS_CHECK(isSameMarker(arena.mark(), start));
+}
+
+void testMarkers()
+{
+    ScratchArena arena(256);
+    void* first = arena.allocate(40, 8);
+    HEADLESS_CHECK(first && isAligned(first, 8));
+
+    // Releasing a marker frees everything allocated after it, so the same memory comes back.
+    ScratchArena::Marker outer = arena.mark();
+    void* a = arena.allocate(24, 8);
+    ScratchArena::Marker inner = arena.mark();
+    void* b = arena.allocate(24, 8);
+    HEADLESS_CHECK(a && b && a != b && a != first);
+    arena.release(inner);
+    HEADLESS_CHECK(arena.allocate(24, 8) == b);
+    arena.release(outer);
+    HEADLESS_CHECK(arena.allocate(24, 8) == a);
+    arena.release(outer);
+
+    // Allocations that don't fit in the first block go to new, larger blocks, which are kept
+    // when released and reused by the next allocations.
+    std::vector<void*> blocks;
+    for (size_t size : { 200, 300, 1000 })
+    {
+        void* p = arena.allocate(size, alignof(std::max_align_t));
+        HEADLESS_CHECK(p && isAligned(p, alignof(std::max_align_t)));
+        blocks.push_back(p);
+    }
+    arena.release(outer);
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        size_t size = i == 0 ? 200 : i == 1 ? 300 : 1000;
+        HEADLESS_CHECK(arena.allocate(size, alignof(std::max_align_t)) == blocks[i]);
+    }
+
+    // Releasing the marker of an empty arena releases everything.
+    ScratchArena empty;
+    ScratchArena::Marker emptyMarker = empty.mark();
+    HEADLESS_CHECK(emptyMarker.block == nullptr && emptyMarker.used == 0);
+    void* p = empty.allocate(16, 8);
+    empty.release(emptyMarker);
+    HEADLESS_CHECK(empty.allocate(16, 8) == p);
+    empty.release(emptyMarker);
+}
+
+void testNestedScopes()
+{
+    ScratchArena& threadArena = ScratchArena::current();
+    HEADLESS_CHECK(&ScratchArena::current() == &threadArena);
+
+    ScratchArena outerArena, innerArena;
+    {
+        ScratchArena::Scope outer(outerArena);
+        HEADLESS_CHECK(&ScratchArena::current() == &outerArena);
+        {
+            ScratchArena::Scope inner(innerArena);
+            HEADLESS_CHECK(&ScratchArena::current() == &innerArena);
+
+            // A ScratchArray uses the arena that is current when it is created.
+            ScratchArena::Marker start = innerArena.mark();
+            ScratchArray<int> array(100);
+            HEADLESS_CHECK(!isSameMarker(innerArena.mark(), start));
+            HEADLESS_CHECK(outerArena.mark().block == nullptr);
+        }
+        HEADLESS_CHECK(&ScratchArena::current() == &outerArena);
+    }
+    HEADLESS_CHECK(&ScratchArena::current() == &threadArena);
+}
+
+void testThreadArenas()
+{
+    // Each thread has its own arena, and a scope on one thread doesn't change the arena of another.
+    ScratchArena& mainArena = ScratchArena::current();
+    ScratchArena scoped;
+    ScratchArena::Scope scope(scoped);
+
+    const int threadCount = 4;
+    std::vector<ScratchArena*> arenas(threadCount);
+    std::atomic<int> startedCount(0);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threadCount; ++thread)
+    {
+        threads.emplace_back([&arenas, &startedCount, thread] {
+            arenas[thread] = &ScratchArena::current();
+
+            // Wait for every thread to have its arena, so that no arena has been destroyed with
+            // its thread, and its address reused, when they are compared.
+            ++startedCount;
+            while (startedCount < threadCount)
+                std::this_thread::yield();
+            for (int i = 0; i < 1000; ++i)
+            {
+                ScratchArray<int> array(64 + i % 64);
+                for (int j = 0; j < 64; ++j)
+                    array[j] = thread;
+                for (int j = 0; j < 64; ++j)
+                    HEADLESS_CHECK(array[j] == thread);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (int thread = 0; thread < threadCount; ++thread)
+    {
+        HEADLESS_CHECK(arenas[thread] != &mainArena && arenas[thread] != &scoped);
+        for (int other = 0; other < thread; ++other)
+            HEADLESS_CHECK(arenas[thread] != arenas[other]);
+    }
+    HEADLESS_CHECK(&ScratchArena::current() == &scoped);
+}
+}// namespace
+
+int main()
+{
+    testScratchArray();
+    testMarkers();
+    testNestedScopes();
+    testThreadArenas();
+    return headless::test::result("ScratchArenaTests");
+}
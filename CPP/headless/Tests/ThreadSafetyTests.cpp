@@ -0,0 +1,198 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Tests of the threading contract of transient geometry described on CurveEvaluator3D: const
+// methods called from several threads at once, references added and released on several threads,
+// and a detached evaluator used while its source curve is transformed. Build with
+// ThreadSanitizer, from the root of the repository, and run the result:
+//
+//     g++ -std=c++17 -O1 -g -fsanitize=thread -I CPP/include -I CPP/headless/Core -I CPP/headless/Core/Geometry
+//         CPP/headless/Tests/ThreadSafetyTests.cpp -o ThreadSafetyTests -pthread
+//
+// The executable returns 0 if every check passed. ThreadSanitizer reports races on stderr and
+// makes the executable return a non-zero code.
+
+#include <HeadlessCore.h>
+#include "HeadlessTest.h"
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace adsk::core;
+
+namespace {
+
+const int threadCount = 4;
+
+// Runs a function on several threads at once, passing each the index of its thread.
+void runThreads(const std::function<void(int thread)>& function)
+{
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threadCount; ++thread)
+        threads.emplace_back(function, thread);
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+Ptr<NurbsCurve3D> testCurve()
+{
+    std::vector<Ptr<Point3D>> controlPoints = { Point3D::create(0.0, 0.0, 0.0), Point3D::create(1.0, 2.0, 0.0),
+                                                Point3D::create(3.0, 2.0, 1.0), Point3D::create(4.0, 0.0, 1.0),
+                                                Point3D::create(6.0, 1.0, 0.0) };
+    return NurbsCurve3D::createNonRational(controlPoints, 3, { 0.0, 0.0, 0.0, 0.0, 0.5, 1.0, 1.0, 1.0, 1.0 }, false);
+}
+
+std::vector<double> testParameters()
+{
+    std::vector<double> res;
+    for (int i = 0; i <= 64; ++i)
+        res.push_back(i / 64.0);
+    return res;
+}
+
+// Every thread evaluates the same evaluator and the same curve and must get the results the
+// main thread got before the threads started.
+void testSharedConstEvaluation()
+{
+    Ptr<NurbsCurve3D> curve = testCurve();
+    Ptr<CurveEvaluator3D> evaluator = curve->evaluator();
+    std::vector<double> parameters = testParameters();
+
+    std::vector<double> expectedPoints;
+    std::vector<Ptr<Vector3D>> directions;
+    std::vector<double> expectedCurvatures;
+    double expectedLength = 0.0;
+    HEADLESS_CHECK(evaluator->getPointsAtParameters(parameters, expectedPoints));
+    HEADLESS_CHECK(evaluator->getCurvatures(parameters, directions, expectedCurvatures));
+    HEADLESS_CHECK(evaluator->getLengthAtParameter(0.0, 1.0, expectedLength));
+
+    runThreads([&](int) {
+        std::vector<double> points;
+        std::vector<Ptr<Vector3D>> threadDirections;
+        std::vector<double> curvatures;
+        for (int i = 0; i < 50; ++i)
+        {
+            double length = 0.0, parameter = 0.0;
+            HEADLESS_CHECK(evaluator->getPointsAtParameters(parameters, points) && points == expectedPoints);
+            HEADLESS_CHECK(evaluator->getCurvatures(parameters, threadDirections, curvatures) && curvatures == expectedCurvatures);
+            HEADLESS_CHECK(evaluator->getLengthAtParameter(0.0, 1.0, length) && length == expectedLength);
+            HEADLESS_CHECK(evaluator->getParameterAtLength(0.0, 0.5 * expectedLength, parameter));
+
+            // Const methods of the curve itself, including creating more evaluators of it.
+            HEADLESS_CHECK(curve->degree() == 3);
+            HEADLESS_CHECK(curve->evaluator()->getPointsAtParameters(parameters, points) && points == expectedPoints);
+        }
+    });
+}
+
+// Threads copy, assign and release references to the same objects. The count must be back where
+// it started once they are done, and the objects must still be usable.
+void testConcurrentPtrCopies()
+{
+    Ptr<Point3D> point = Point3D::create(1.0, 2.0, 3.0);
+    Ptr<NurbsCurve3D> curve = testCurve();
+    long pointCount = point->refCount();
+    long curveCount = curve->refCount();
+
+    runThreads([&](int thread) {
+        std::vector<Ptr<Point3D>> copies;
+        Ptr<Base> base;
+        for (int i = 0; i < 20000; ++i)
+        {
+            Ptr<Point3D> copy = point;
+            Ptr<Point3D> other;
+            other = copy;
+            copies.push_back(other);
+            if (copies.size() == 64)
+                copies.clear();
+            base = curve;
+            Ptr<Curve3D> asCurve = base;
+            HEADLESS_CHECK(asCurve);
+            if ((i + thread) % 1000 == 0)
+                HEADLESS_CHECK(copy->y() == 2.0);
+        }
+    });
+
+    HEADLESS_CHECK(point->refCount() == pointCount);
+    HEADLESS_CHECK(curve->refCount() == curveCount);
+    HEADLESS_CHECK(point->x() == 1.0 && point->z() == 3.0);
+}
+
+// A detached evaluator works on a copy of the curve, so worker threads can use it while another
+// thread, which has exclusive use of the source curve, transforms it.
+void testDetachedEvaluatorRacingTransform()
+{
+    std::vector<double> parameters = testParameters();
+    for (int curveType = 0; curveType < 3; ++curveType)
+    {
+        Ptr<Curve3D> curve;
+        if (curveType == 0)
+            curve = testCurve();
+        else if (curveType == 1)
+            curve = Arc3D::createByCenter(Point3D::create(), Vector3D::create(0.0, 0.0, 1.0), Vector3D::create(1.0, 0.0, 0.0), 2.0, 0.0, 3.0);
+        else
+            curve = Line3D::create(Point3D::create(), Point3D::create(1.0, 1.0, 0.0));
+        if (!HEADLESS_CHECK(curve))
+            continue;
+
+        Ptr<CurveEvaluator3D> detached = curve->detachedEvaluator();
+        double startParameter = 0.0, endParameter = 0.0;
+        HEADLESS_CHECK(detached->getParameterExtents(startParameter, endParameter));
+        std::vector<double> curveParameters;
+        for (double parameter : parameters)
+            curveParameters.push_back(startParameter + parameter * (endParameter - startParameter));
+        std::vector<double> expectedPoints;
+        HEADLESS_CHECK(detached->getPointsAtParameters(curveParameters, expectedPoints));
+
+        // The source is transformed for as long as the workers evaluate, alternating between two
+        // positions so its coordinates stay small.
+        std::atomic<bool> isEvaluating(true);
+        int transformCount = 0;
+        std::thread transformer([&] {
+            Ptr<Matrix3D> forward = Matrix3D::create();
+            forward->translation(Vector3D::create(0.5, -0.25, 1.0));
+            Ptr<Matrix3D> back = Matrix3D::create();
+            back->translation(Vector3D::create(-0.5, 0.25, -1.0));
+            while (isEvaluating || transformCount % 2 == 0)
+            {
+                HEADLESS_CHECK(curve->transformBy(transformCount % 2 == 0 ? forward : back));
+                ++transformCount;
+            }
+        });
+        runThreads([&](int) {
+            std::vector<double> points;
+            for (int i = 0; i < 200; ++i)
+                HEADLESS_CHECK(detached->getPointsAtParameters(curveParameters, points) && points == expectedPoints);
+        });
+        isEvaluating = false;
+        transformer.join();
+
+        // The source was transformed an odd number of times, so it has moved, and the detached
+        // evaluator still evaluates the original.
+        Ptr<Point3D> moved;
+        HEADLESS_CHECK(transformCount > 1);
+        HEADLESS_CHECK(curve->evaluator()->getPointAtParameter(curveParameters[0], moved));
+        HEADLESS_CHECK(std::fabs(moved->x() - expectedPoints[0] - 0.5) < 1e-9);
+        HEADLESS_CHECK(std::fabs(moved->z() - expectedPoints[2] - 1.0) < 1e-9);
+        std::vector<double> points;
+        HEADLESS_CHECK(detached->getPointsAtParameters(curveParameters, points) && points == expectedPoints);
+    }
+}
+}// namespace
+
+int main()
+{
+    testSharedConstEvaluation();
+    testConcurrentPtrCopies();
+    testDetachedEvaluatorRacingTransform();
+    return headless::test::result("ThreadSafetyTests");
+}
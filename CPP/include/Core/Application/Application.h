@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
 #include <vector>
 
@@ -30,6 +31,7 @@
 
 namespace adsk { namespace core {
     class ApplicationEvent;
+    class BatchErrors;
     class CameraEvent;
     class CustomEvent;
     class Data;
@@ -37,13 +39,18 @@ namespace adsk { namespace core {
     class Document;
     class DocumentEvent;
     class Documents;
+    class EventStatistics;
     class FavoriteAppearances;
     class FavoriteMaterials;
     class ImportManager;
+    class Job;
     class MaterialLibraries;
     class MeasureManager;
     class Preferences;
     class Product;
+    class StartupTrace;
+    class TextCommandResult;
+    class TextCommandResultHandler;
     class User;
     class UserInterface;
     class Viewport;
@@ -108,11 +115,18 @@ public:
     /// referenced documents by using the documentReferences property of the Document object.
     Ptr<DocumentEvent> documentOpened() const;
 
-    /// Returns information about the last error that occurred.
+    /// Returns information about the last error that occurred on the calling thread. Each thread has its own
+    /// last error, so an API call that fails on a worker thread doesn't change the error seen by the main thread
+    /// or by other workers, and a worker can check its own errors without synchronizing with the main thread.
     /// description : A description of the last error in English.
     /// Returns the number of the specific error.
     int getLastError(std::string* description = nullptr) const;
 
+    /// Returns the errors of each element of the last call made on the calling thread that works on an array of
+    /// elements, such as CompiledExpression.evaluateBatch. Like getLastError, these are kept for each thread.
+    /// Returns the BatchErrors of the last such call, or null if no such call has been made on this thread.
+    Ptr<BatchErrors> getLastBatchErrors() const;
+
     /// Provides access to functionality specific to the user interface.
     Ptr<UserInterface> userInterface() const;
 
@@ -165,6 +179,10 @@ public:
     /// The client can add or remove ApplicationEventHandlers from the ApplicationEvent.
     Ptr<ApplicationEvent> startupCompleted() const;
 
+    /// Returns the StartupTrace object, which reports the time spent running each add-in loaded at startup and
+    /// the time spent creating its command definitions, toolbar items and palettes.
+    Ptr<StartupTrace> startupTrace() const;
+
     /// Returns the User that is currently logged in.
     Ptr<User> currentUser() const;
 
@@ -209,6 +227,10 @@ public:
     /// 
     /// Firing a custom event does not immediately result in the event handler being called. When a custom
     /// event is fired the event is put on the queue and will be handled in the main thread when Fusion 360 is idle.
+    /// 
+    /// This method can be called from any number of threads at once. Each fire is added to a lock-free queue
+    /// of the event, and fires that are pending when the handlers are notified are delivered together, as
+    /// controlled by the maximumBatchSize and maximumRate properties of the CustomEvent.
     /// eventId : The ID of the custom event you want to fire.
     /// additionalInfo : Any additional information you want to pass through the event to the add-in in the primary thread.
     /// Returns true if the event was successfully added to the event queue. A value of true does not indicate
@@ -266,6 +288,29 @@ public:
     /// Returns the result of the input text command.
     std::string executeTextCommand(const std::string& command) const;
 
+    /// Executes a list of text commands in order. The commands are all parsed before any of them runs
+    /// and the changes they make are combined into a single transaction, so they're undone together as
+    /// one step. This is much faster than calling executeTextCommand for each command.
+    /// commands : The text commands to execute.
+    /// stopOnFailure : Specifies what happens when a command fails, or can't be parsed. If true, no more
+    /// commands are run and the changes made by the commands already run are rolled back. If false, the
+    /// remaining commands are run and the changes of those that succeeded are kept.
+    /// Returns the result of each command that was run, in the same order as the commands. When
+    /// stopOnFailure is true and a command fails, the last result is that of the failed command.
+    std::vector<Ptr<TextCommandResult>> executeTextCommands(const std::vector<std::string>& commands, bool stopOnFailure = true) const;
+
+    /// Executes a list of text commands in order, in the same way as the other executeTextCommands
+    /// method, but passes the result of each command to a handler as soon as the command has run
+    /// instead of returning them all at the end. Use this for long lists of commands so that their
+    /// output isn't held in memory until the whole list has run.
+    /// commands : The text commands to execute.
+    /// handler : The client implemented handler that is called with the result of each command.
+    /// stopOnFailure : Specifies what happens when a command fails, or can't be parsed. If true, no more
+    /// commands are run and the changes made by the commands already run are rolled back. If false, the
+    /// remaining commands are run and the changes of those that succeeded are kept.
+    /// Returns true if all of the commands were executed successfully.
+    bool executeTextCommands(const std::vector<std::string>& commands, TextCommandResultHandler* handler, bool stopOnFailure = true) const;
+
     /// Logs messages to either the TEXT COMMAND window or the Fusion app log file.
     /// message : The message to write to the log.
     /// level : The log level. Default value is InfoLogLevel. This is only used when the log type is FileLogType where the
@@ -276,6 +321,9 @@ public:
     /// In the lower-right corner you can choose "Txt", "Py", or "Js". Choose the "Txt" option and type "paths.get" in the
     /// input field and press return. A list of all of the various paths used by Fusion will be displayed in the TEXT COMMAND
     /// window. The line for "AppLogFilePath" has the full path to the log file.
+    /// 
+    /// Each call writes the message before returning. For logging from worker threads or code that runs many
+    /// times per frame, use AsyncLog, which queues records without blocking and writes them on another thread.
     static void log(const std::string& message, LogLevels level = adsk::core::InfoLogLevel, LogTypes type = adsk::core::ConsoleLogType);
 
     /// The dataFileComplete event fires when a data file upload has completed including any cloud side translations.
@@ -289,9 +337,23 @@ public:
     std::string token() const;
     bool token(const std::string& value);
 
-    /// Gets whether there are any active jobs.
+    /// Gets whether there are any active jobs. Use activeJobs to get the jobs themselves.
     bool hasActiveJobs() const;
 
+    /// Returns the jobs that are running in the background, such as uploads, translations and recomputes,
+    /// in the order they were started.
+    std::vector<Ptr<Job>> activeJobs() const;
+
+    /// Waits for a set of jobs to complete, or for a timeout. Use this instead of calling hasActiveJobs in a
+    /// loop. While waiting, Fusion continues to process messages, so the user interface stays responsive and
+    /// events, including the completed events of the jobs, are fired. Jobs that have already completed are
+    /// counted as complete.
+    /// jobs : The jobs to wait for.
+    /// timeout : The longest time to wait, in seconds. Use a negative value to wait without a timeout.
+    /// Returns true if all of the jobs have completed, whether they succeeded or not. Returns false if the
+    /// timeout was reached first. Use Job.isSuccess to check the result of each job.
+    bool waitForJobs(const std::vector<Ptr<Job>>& jobs, double timeout = -1) const;
+
     /// !!!!! Warning !!!!!
     /// ! This is hidden and not officially supported
     /// !!!!! Warning !!!!!
@@ -303,6 +365,10 @@ public:
     /// Returns the names of all of the fonts that are available in Fusion when creating text.
     std::vector<std::string> fontNames() const;
 
+    /// Returns the EventStatistics object which provides the call counts and timings of the event
+    /// handlers added by add-ins and scripts, and exports them as a trace.
+    Ptr<EventStatistics> eventStatistics() const;
+
     ADSK_CORE_APPLICATION_API static const char* classType();
     ADSK_CORE_APPLICATION_API const char* objectType() const override;
     ADSK_CORE_APPLICATION_API void* queryInterface(const char* id) const override;
@@ -366,6 +432,13 @@ private:
     virtual char* crashDescription_raw() const = 0;
     virtual bool crashDescription_raw(const char* value) = 0;
     virtual char** fontNames_raw(size_t& return_size) const = 0;
+    virtual EventStatistics* eventStatistics_raw() const = 0;
+    virtual TextCommandResult** executeTextCommands_raw(const char** commands, size_t commands_size, bool stopOnFailure, size_t& return_size) const = 0;
+    virtual bool executeTextCommands_raw(const char** commands, size_t commands_size, TextCommandResultHandler* handler, bool stopOnFailure) const = 0;
+    virtual BatchErrors* getLastBatchErrors_raw() const = 0;
+    virtual StartupTrace* startupTrace_raw() const = 0;
+    virtual Job** activeJobs_raw(size_t& return_size) const = 0;
+    virtual bool waitForJobs_raw(Job** jobs, size_t jobs_size, double timeout) const = 0;
 };
 
 // Inline wrappers
@@ -777,6 +850,80 @@ inline std::vector<std::string> Application::fontNames() const
     }
     return res;
 }
+
+inline Ptr<EventStatistics> Application::eventStatistics() const
+{
+    Ptr<EventStatistics> res = eventStatistics_raw();
+    return res;
+}
+
+inline std::vector<Ptr<TextCommandResult>> Application::executeTextCommands(const std::vector<std::string>& commands, bool stopOnFailure) const
+{
+    ScratchArray<const char*> commands_(commands.size());
+    for(size_t i = 0; i < commands.size(); ++i)
+    {
+        commands_[i] = commands[i].c_str();
+    }
+
+    std::vector<Ptr<TextCommandResult>> res;
+    size_t s;
+
+    TextCommandResult** p= executeTextCommands_raw(commands_, commands.size(), stopOnFailure, s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool Application::executeTextCommands(const std::vector<std::string>& commands, TextCommandResultHandler* handler, bool stopOnFailure) const
+{
+    ScratchArray<const char*> commands_(commands.size());
+    for(size_t i = 0; i < commands.size(); ++i)
+    {
+        commands_[i] = commands[i].c_str();
+    }
+
+    bool res = executeTextCommands_raw(commands_, commands.size(), handler, stopOnFailure);
+    return res;
+}
+
+inline Ptr<BatchErrors> Application::getLastBatchErrors() const
+{
+    Ptr<BatchErrors> res = getLastBatchErrors_raw();
+    return res;
+}
+
+inline Ptr<StartupTrace> Application::startupTrace() const
+{
+    Ptr<StartupTrace> res = startupTrace_raw();
+    return res;
+}
+
+inline std::vector<Ptr<Job>> Application::activeJobs() const
+{
+    std::vector<Ptr<Job>> res;
+    size_t s;
+
+    Job** p= activeJobs_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool Application::waitForJobs(const std::vector<Ptr<Job>>& jobs, double timeout) const
+{
+    ScratchArray<Job*> jobs_(jobs.size());
+    for(size_t i=0; i<jobs.size(); ++i)
+        jobs_[i] = jobs[i].get();
+
+    bool res = waitForJobs_raw(jobs_, jobs.size(), timeout);
+    return res;
+}
 }// namespace core
 }// namespace adsk
 
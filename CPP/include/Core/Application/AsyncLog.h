@@ -0,0 +1,659 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../CoreTypeDefs.h"
+#include "Application.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// THIS CLASS IS USED BY AN API CLIENT
+
+namespace adsk { namespace core {
+
+/// A named value attached to a log record. Fields are stored in binary form when the record is
+/// written and are only converted to text by the sinks that need text, on the thread that drains
+/// the log.
+class LogField {
+public:
+
+    enum Kinds { IntegerKind = 0, RealKind, BooleanKind, StringKind };
+
+    LogField(const char* name, int value) : m_name(name ? name : ""), m_kind(IntegerKind) { m_value.integer = value; }
+    LogField(const char* name, long value) : m_name(name ? name : ""), m_kind(IntegerKind) { m_value.integer = value; }
+    LogField(const char* name, long long value) : m_name(name ? name : ""), m_kind(IntegerKind) { m_value.integer = value; }
+    LogField(const char* name, unsigned value) : m_name(name ? name : ""), m_kind(IntegerKind) { m_value.integer = value; }
+    LogField(const char* name, unsigned long value) : m_name(name ? name : ""), m_kind(IntegerKind) { m_value.integer = static_cast<int64_t>(value); }
+    LogField(const char* name, unsigned long long value) : m_name(name ? name : ""), m_kind(IntegerKind) { m_value.integer = static_cast<int64_t>(value); }
+    LogField(const char* name, double value) : m_name(name ? name : ""), m_kind(RealKind) { m_value.real = value; }
+    LogField(const char* name, float value) : m_name(name ? name : ""), m_kind(RealKind) { m_value.real = value; }
+    LogField(const char* name, bool value) : m_name(name ? name : ""), m_kind(BooleanKind) { m_value.integer = value ? 1 : 0; }
+
+    /// The string is copied when the record is written, so it only has to live until write returns.
+    LogField(const char* name, const char* value) : m_name(name ? name : ""), m_kind(StringKind), m_string(value ? value : ""), m_length(std::strlen(m_string)) {}
+    LogField(const char* name, const std::string& value) : m_name(name ? name : ""), m_kind(StringKind), m_string(value.c_str()), m_length(value.size()) {}
+
+private:
+    friend class AsyncLog;
+
+    const char* m_name;
+    Kinds m_kind;
+    union { int64_t integer; double real; } m_value;
+    const char* m_string = nullptr;
+    size_t m_length = 0;
+};
+
+/// A log record as it is passed to the sinks of an AsyncLog. The record is a view of the binary
+/// form the record was written in and is only valid during the call to AsyncLogSink::write.
+///
+/// The binary form, which is also the format of the records in a file written by
+/// BinaryFileLogSink, is in the byte order of the machine that wrote it:
+///
+///     uint32  size of the record in bytes, a multiple of 8
+///     uint16  length of the message
+///     uint8   level, a LogLevels value
+///     uint8   number of fields
+///     uint64  time the record was written, in nanoseconds since 1970-01-01 UTC
+///     uint32  index of the thread that wrote the record, in the order threads first wrote to the log
+///     uint32  reserved
+///     char    message, not null terminated
+///     for each field:
+///         uint8   kind, a LogField::Kinds value
+///         uint8   length of the name
+///         char    name, not null terminated
+///         int64 or double   value of IntegerKind, BooleanKind and RealKind fields
+///         uint32 then char  length and characters of StringKind fields
+///     padding to the size of the record
+class LogRecord {
+public:
+
+    /// The value of a field of a record.
+    struct Field
+    {
+        std::string name() const { return std::string(nameData, nameLength); }
+        std::string toString() const
+        {
+            char text[32];
+            switch (kind)
+            {
+            case LogField::IntegerKind:
+                std::snprintf(text, sizeof(text), "%lld", static_cast<long long>(integer));
+                return text;
+            case LogField::RealKind:
+                std::snprintf(text, sizeof(text), "%.17g", real);
+                return text;
+            case LogField::BooleanKind:
+                return integer ? "true" : "false";
+            default:
+                return std::string(string, stringLength);
+            }
+        }
+
+        LogField::Kinds kind;
+        const char* nameData;
+        size_t nameLength;
+        int64_t integer;
+        double real;
+        const char* string;
+        size_t stringLength;
+    };
+
+    static const size_t headerSize = 24;
+
+    LogRecord(const char* data) : m_data(data) {}
+
+    /// Returns the binary form of the record.
+    const char* data() const { return m_data; }
+    size_t size() const { return read<uint32_t>(0); }
+
+    LogLevels level() const { return static_cast<LogLevels>(static_cast<uint8_t>(m_data[6])); }
+    uint64_t timestamp() const { return read<uint64_t>(8); }
+    uint32_t threadIndex() const { return read<uint32_t>(16); }
+    std::string message() const { return std::string(m_data + headerSize, read<uint16_t>(4)); }
+    size_t fieldCount() const { return static_cast<uint8_t>(m_data[7]); }
+
+    /// Returns the fields of the record.
+    std::vector<Field> fields() const
+    {
+        std::vector<Field> res(fieldCount());
+        size_t offset = headerSize + read<uint16_t>(4);
+        for (Field& field : res)
+        {
+            field.kind = static_cast<LogField::Kinds>(static_cast<uint8_t>(m_data[offset]));
+            field.nameLength = static_cast<uint8_t>(m_data[offset + 1]);
+            field.nameData = m_data + offset + 2;
+            offset += 2 + field.nameLength;
+            field.integer = 0;
+            field.real = 0.0;
+            field.string = nullptr;
+            field.stringLength = 0;
+            if (field.kind == LogField::StringKind)
+            {
+                field.stringLength = read<uint32_t>(offset);
+                field.string = m_data + offset + 4;
+                offset += 4 + field.stringLength;
+            }
+            else
+            {
+                if (field.kind == LogField::RealKind)
+                    field.real = read<double>(offset);
+                else
+                    field.integer = read<int64_t>(offset);
+                offset += 8;
+            }
+        }
+        return res;
+    }
+
+    /// Returns the record as a line of text: the level, the message and the fields as name=value.
+    std::string format() const
+    {
+        static const char* const levels[] = { "Error", "Warning", "Info" };
+        size_t level = static_cast<size_t>(this->level());
+        std::string res = level < 3 ? levels[level] : "Unknown";
+        res += ": ";
+        res += formatMessage();
+        return res;
+    }
+
+    /// Returns the message followed by the fields as name=value, without the level.
+    std::string formatMessage() const
+    {
+        std::string res = message();
+        for (const Field& field : fields())
+        {
+            res += ' ';
+            res += field.name();
+            res += '=';
+            res += field.toString();
+        }
+        return res;
+    }
+
+private:
+    template <class T>
+    T read(size_t offset) const
+    {
+        T value;
+        std::memcpy(&value, m_data + offset, sizeof(T));
+        return value;
+    }
+
+    const char* m_data;
+};
+
+/// Receives the records drained from an AsyncLog. The sinks of a log are called on the thread that
+/// drains it, one record at a time.
+class AsyncLogSink {
+public:
+    virtual ~AsyncLogSink() {}
+
+    virtual void write(const LogRecord& record) = 0;
+
+    /// Called after each batch of records has been written.
+    virtual void flush() {}
+};
+
+/// Writes the records to a file in their binary form, after an 8 byte header of "ADSKLOG1". This is
+/// the cheapest sink because records are copied to the file without being formatted. The file can
+/// be read with readBinaryLog.
+class BinaryFileLogSink : public AsyncLogSink {
+public:
+    explicit BinaryFileLogSink(const std::string& filename) : m_file(std::fopen(filename.c_str(), "wb"))
+    {
+        if (m_file)
+            std::fwrite(fileHeader(), 1, 8, m_file);
+    }
+
+    ~BinaryFileLogSink() override
+    {
+        if (m_file)
+            std::fclose(m_file);
+    }
+
+    /// Indicates if the file was successfully opened.
+    bool isOpen() const { return m_file != nullptr; }
+
+    void write(const LogRecord& record) override
+    {
+        if (m_file)
+            std::fwrite(record.data(), 1, record.size(), m_file);
+    }
+
+    void flush() override
+    {
+        if (m_file)
+            std::fflush(m_file);
+    }
+
+    static const char* fileHeader() { return "ADSKLOG1"; }
+
+private:
+    BinaryFileLogSink(const BinaryFileLogSink&) = delete;
+    BinaryFileLogSink& operator=(const BinaryFileLogSink&) = delete;
+
+    FILE* m_file;
+};
+
+/// Writes the records as lines of text, as returned by LogRecord::format, to a stream such as stderr.
+class TextLogSink : public AsyncLogSink {
+public:
+    explicit TextLogSink(FILE* stream) : m_stream(stream) {}
+
+    void write(const LogRecord& record) override
+    {
+        std::string line = record.format();
+        line += '\n';
+        std::fwrite(line.data(), 1, line.size(), m_stream);
+    }
+
+    void flush() override { std::fflush(m_stream); }
+
+private:
+    FILE* m_stream;
+};
+
+/// Passes the records to Application::log, with the level of each record, so they go to the Fusion
+/// app log file or the TEXT COMMAND window along with the messages logged directly. Application::log
+/// is called on the thread that drains the log, and it is only documented to be called on the main
+/// thread, so a log with this sink must be drained by calling AsyncLog::flush on the main thread,
+/// for example from a CustomEvent handler, and not by the background thread of AsyncLog::start.
+class ApplicationLogSink : public AsyncLogSink {
+public:
+    /// type : Where Application::log writes the records.
+    explicit ApplicationLogSink(LogTypes type = ConsoleLogType) : m_type(type) {}
+
+    void write(const LogRecord& record) override
+    {
+        Application::log(record.formatMessage(), record.level(), m_type);
+    }
+
+private:
+    LogTypes m_type;
+};
+
+/// Reads a file written by BinaryFileLogSink, calling a function for each record in the order the
+/// records were written.
+/// filename : The full filename of the file to read.
+/// function : Called with each record. The record is only valid during the call.
+/// Returns false if the file can't be read or isn't a binary log file.
+inline bool readBinaryLog(const std::string& filename, const std::function<void(const LogRecord& record)>& function)
+{
+    FILE* file = std::fopen(filename.c_str(), "rb");
+    if (!file)
+        return false;
+    char header[8];
+    bool res = std::fread(header, 1, 8, file) == 8 && std::memcmp(header, BinaryFileLogSink::fileHeader(), 8) == 0;
+    std::vector<char> record;
+    while (res)
+    {
+        uint32_t size = 0;
+        if (std::fread(&size, 1, sizeof(size), file) != sizeof(size))
+            break;
+        if (size < LogRecord::headerSize)
+        {
+            res = false;
+            break;
+        }
+        record.resize(size);
+        std::memcpy(&record[0], &size, sizeof(size));
+        if (std::fread(&record[sizeof(size)], 1, size - sizeof(size), file) != size - sizeof(size))
+        {
+            res = false;
+            break;
+        }
+        function(LogRecord(&record[0]));
+    }
+    std::fclose(file);
+    return res;
+}
+
+/// Asynchronous log for use in code where Application::log is too slow, such as tracing inside
+/// geometry loops and worker threads.
+///
+/// Writing a record checks the level first, so a record that is filtered out costs only a
+/// comparison. An accepted record is copied in binary form, without formatting, into a ring buffer
+/// that belongs to the writing thread. The buffers are lock-free and each has a single writer, so
+/// threads never wait for each other or for the sinks. A background thread, or a call to flush,
+/// drains the buffers and passes the records to the sinks on its own thread. ApplicationLogSink,
+/// which sends them on to Application::log, needs the log to be drained on the main thread. When a thread writes faster than its buffer is drained, the records that
+/// don't fit are dropped and counted rather than blocking.
+///
+/// Records are delivered in order for each thread. Records of different threads are delivered in
+/// batches and can be put back in order using their timestamps.
+///
+///     AsyncLog log;
+///     log.addSink(std::unique_ptr<AsyncLogSink>(new BinaryFileLogSink(path)));
+///     log.start();
+///     ...
+///     log.write(InfoLogLevel, "pass complete", { { "pass", pass }, { "time", seconds } });
+///
+/// A thread's buffer is kept until the log is destroyed, so a log used by threads that are created
+/// and destroyed repeatedly grows by one buffer for each thread.
+class AsyncLog {
+public:
+
+    /// Creates a log.
+    /// bufferSize : The size in bytes of the buffer of each thread, rounded up to a power of 2. A
+    /// record takes 24 bytes plus the message and fields, rounded up to a multiple of 8.
+    explicit AsyncLog(size_t bufferSize = 64 * 1024)
+        : m_bufferSize(1024), m_level(static_cast<int>(InfoLogLevel)), m_serial(nextSerial()), m_isRunning(false), m_stopRequested(false)
+    {
+        while (m_bufferSize < bufferSize)
+            m_bufferSize *= 2;
+    }
+
+    ~AsyncLog() { stop(); }
+
+    /// Gets and sets the least severe level that is logged. Records with a less severe level are
+    /// discarded by write. The default is InfoLogLevel, which logs everything.
+    LogLevels level() const { return static_cast<LogLevels>(m_level.load(std::memory_order_relaxed)); }
+    void level(LogLevels value) { m_level.store(static_cast<int>(value), std::memory_order_relaxed); }
+
+    /// Indicates if records of a level are logged. Use this to skip computing the fields of a record
+    /// when they are expensive.
+    bool isEnabled(LogLevels level) const { return static_cast<int>(level) <= m_level.load(std::memory_order_relaxed); }
+
+    /// Adds a sink that receives the records. Sinks can be added at any time.
+    void addSink(std::unique_ptr<AsyncLogSink> sink)
+    {
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        m_sinks.push_back(std::move(sink));
+    }
+
+    /// Writes a record. This can be called from any thread and doesn't block.
+    /// level : The level of the record. Nothing is written if it is less severe than the level of the log.
+    /// message : The message of the record. Messages longer than 65535 characters are truncated, and a
+    /// null message is written as an empty one.
+    /// fields : Named values that are stored with the record. At most 255 fields are stored.
+    /// Returns true if the record was written, or false if it was filtered out by its level or
+    /// dropped because the buffer of the thread was full.
+    bool write(LogLevels level, const char* message, std::initializer_list<LogField> fields = {})
+    {
+        if (!isEnabled(level))
+            return false;
+        return append(level, message ? message : "", message ? std::strlen(message) : 0, fields);
+    }
+
+    bool write(LogLevels level, const std::string& message, std::initializer_list<LogField> fields = {})
+    {
+        if (!isEnabled(level))
+            return false;
+        return append(level, message.data(), message.size(), fields);
+    }
+
+    /// Starts a background thread that drains the log.
+    /// interval : How often the thread drains the log when it is idle.
+    /// Returns false if the thread is already running.
+    bool start(std::chrono::milliseconds interval = std::chrono::milliseconds(50))
+    {
+        std::lock_guard<std::mutex> lock(m_threadMutex);
+        if (m_isRunning)
+            return false;
+        m_stopRequested = false;
+        m_isRunning = true;
+        m_thread = std::thread([this, interval] {
+            std::unique_lock<std::mutex> lock(m_threadMutex);
+            while (!m_stopRequested)
+            {
+                lock.unlock();
+                flush();
+                lock.lock();
+                m_wakeUp.wait_for(lock, interval, [this] { return m_stopRequested; });
+            }
+        });
+        return true;
+    }
+
+    /// Stops the background thread, if it is running, and drains the records that are left.
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_threadMutex);
+            m_stopRequested = true;
+        }
+        m_wakeUp.notify_all();
+        if (m_thread.joinable())
+            m_thread.join();
+        {
+            std::lock_guard<std::mutex> lock(m_threadMutex);
+            m_isRunning = false;
+        }
+        flush();
+    }
+
+    /// Drains the records written so far to the sinks on the calling thread and flushes the sinks.
+    /// Returns the number of records drained.
+    size_t flush()
+    {
+        std::lock_guard<std::mutex> drainLock(m_drainMutex);
+        std::vector<ThreadBuffer*> buffers;
+        {
+            std::lock_guard<std::mutex> lock(m_buffersMutex);
+            for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers)
+                buffers.push_back(buffer.get());
+        }
+        size_t res = 0;
+        for (ThreadBuffer* buffer : buffers)
+            res += drain(*buffer);
+        if (res > 0)
+        {
+            for (const std::unique_ptr<AsyncLogSink>& sink : m_sinks)
+                sink->flush();
+        }
+        return res;
+    }
+
+    /// Returns the number of records that were dropped because the buffer of the writing thread was full.
+    uint64_t droppedCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        uint64_t res = 0;
+        for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers)
+            res += buffer->dropped.load(std::memory_order_relaxed);
+        return res;
+    }
+
+private:
+    AsyncLog(const AsyncLog&) = delete;
+    AsyncLog& operator=(const AsyncLog&) = delete;
+
+    // Single writer, single reader ring of records. The positions only increase; the index into
+    // the data is the position modulo the size.
+    struct ThreadBuffer
+    {
+        ThreadBuffer(size_t size, uint32_t index) : data(size), mask(size - 1), threadIndex(index), owner(std::this_thread::get_id()) {}
+
+        std::vector<char> data;
+        size_t mask;
+        uint32_t threadIndex;
+        std::thread::id owner;
+        std::atomic<uint64_t> dropped { 0 };
+
+        // The positions are kept on separate cache lines so the writer and the reader don't contend.
+        char separator1[64];
+        std::atomic<uint64_t> writePosition { 0 };
+        char separator2[64];
+        std::atomic<uint64_t> readPosition { 0 };
+    };
+
+    // Marks the unused space at the end of a ring when a record doesn't fit before the end.
+    static const uint8_t paddingLevel = 0xFF;
+
+    static uint64_t nextSerial()
+    {
+        static std::atomic<uint64_t> serial(0);
+        return ++serial;
+    }
+
+    // Finds the buffer of the calling thread, using a cache of the last log the thread wrote to.
+    ThreadBuffer& threadBuffer()
+    {
+        struct Cache
+        {
+            uint64_t serial;
+            ThreadBuffer* buffer;
+        };
+        static thread_local Cache cache = { 0, nullptr };
+        if (cache.serial == m_serial)
+            return *cache.buffer;
+
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        std::thread::id id = std::this_thread::get_id();
+        ThreadBuffer* buffer = nullptr;
+        for (const std::unique_ptr<ThreadBuffer>& existing : m_buffers)
+        {
+            if (existing->owner == id)
+                buffer = existing.get();
+        }
+        if (!buffer)
+        {
+            m_buffers.emplace_back(new ThreadBuffer(m_bufferSize, static_cast<uint32_t>(m_buffers.size())));
+            buffer = m_buffers.back().get();
+        }
+        cache.serial = m_serial;
+        cache.buffer = buffer;
+        return *buffer;
+    }
+
+    bool append(LogLevels level, const char* message, size_t messageLength, std::initializer_list<LogField> fields)
+    {
+        if (messageLength > 0xFFFF)
+            messageLength = 0xFFFF;
+        size_t fieldCount = fields.size() < 0xFF ? fields.size() : 0xFF;
+        size_t size = LogRecord::headerSize + messageLength;
+        size_t index = 0;
+        for (const LogField& field : fields)
+        {
+            if (index++ == fieldCount)
+                break;
+            size += 2 + std::min<size_t>(std::strlen(field.m_name), 0xFF);
+            size += field.m_kind == LogField::StringKind ? 4 + field.m_length : 8;
+        }
+        size = (size + 7) & ~static_cast<size_t>(7);
+
+        ThreadBuffer& buffer = threadBuffer();
+        size_t capacity = buffer.data.size();
+        uint64_t write = buffer.writePosition.load(std::memory_order_relaxed);
+        uint64_t read = buffer.readPosition.load(std::memory_order_acquire);
+        size_t offset = static_cast<size_t>(write & buffer.mask);
+        size_t untilEnd = capacity - offset;
+        size_t needed = size <= untilEnd ? size : untilEnd + size;
+        if (size > capacity / 2 || write + needed - read > capacity)
+        {
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (size > untilEnd)
+        {
+            char* padding = &buffer.data[offset];
+            uint32_t paddingSize = static_cast<uint32_t>(untilEnd);
+            std::memcpy(padding, &paddingSize, sizeof(paddingSize));
+            padding[6] = static_cast<char>(paddingLevel);
+            write += untilEnd;
+            offset = 0;
+        }
+
+        char* p = &buffer.data[offset];
+        uint32_t recordSize = static_cast<uint32_t>(size);
+        uint16_t length = static_cast<uint16_t>(messageLength);
+        uint64_t timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+        uint32_t reserved = 0;
+        std::memcpy(p, &recordSize, 4);
+        std::memcpy(p + 4, &length, 2);
+        p[6] = static_cast<char>(level);
+        p[7] = static_cast<char>(fieldCount);
+        std::memcpy(p + 8, &timestamp, 8);
+        std::memcpy(p + 16, &buffer.threadIndex, 4);
+        std::memcpy(p + 20, &reserved, 4);
+        std::memcpy(p + LogRecord::headerSize, message, messageLength);
+        p += LogRecord::headerSize + messageLength;
+        index = 0;
+        for (const LogField& field : fields)
+        {
+            if (index++ == fieldCount)
+                break;
+            size_t nameLength = std::min<size_t>(std::strlen(field.m_name), 0xFF);
+            p[0] = static_cast<char>(field.m_kind);
+            p[1] = static_cast<char>(nameLength);
+            std::memcpy(p + 2, field.m_name, nameLength);
+            p += 2 + nameLength;
+            if (field.m_kind == LogField::StringKind)
+            {
+                uint32_t stringLength = static_cast<uint32_t>(field.m_length);
+                std::memcpy(p, &stringLength, 4);
+                std::memcpy(p + 4, field.m_string, field.m_length);
+                p += 4 + field.m_length;
+            }
+            else
+            {
+                std::memcpy(p, &field.m_value, 8);
+                p += 8;
+            }
+        }
+        buffer.writePosition.store(write + size, std::memory_order_release);
+        return true;
+    }
+
+    // Passes the records of a buffer to the sinks. Called with the drain mutex locked, so there is
+    // only one reader of each buffer.
+    size_t drain(ThreadBuffer& buffer)
+    {
+        size_t res = 0;
+        uint64_t read = buffer.readPosition.load(std::memory_order_relaxed);
+        uint64_t write = buffer.writePosition.load(std::memory_order_acquire);
+        while (read < write)
+        {
+            const char* p = &buffer.data[static_cast<size_t>(read & buffer.mask)];
+            LogRecord record(p);
+            if (static_cast<uint8_t>(p[6]) != paddingLevel)
+            {
+                for (const std::unique_ptr<AsyncLogSink>& sink : m_sinks)
+                    sink->write(record);
+                ++res;
+            }
+            read += record.size();
+            buffer.readPosition.store(read, std::memory_order_release);
+        }
+        return res;
+    }
+
+    size_t m_bufferSize;
+    std::atomic<int> m_level;
+    const uint64_t m_serial;
+
+    mutable std::mutex m_buffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+
+    std::mutex m_drainMutex;
+    std::vector<std::unique_ptr<AsyncLogSink>> m_sinks;
+
+    std::mutex m_threadMutex;
+    std::condition_variable m_wakeUp;
+    std::thread m_thread;
+    bool m_isRunning;
+    bool m_stopRequested;
+};
+
+}// namespace core
+}// namespace adsk
@@ -41,9 +41,39 @@ public:
     /// Gets the name of the group this attribute is a part of.
     std::string groupName() const;
 
+    /// Gets the name of the group this attribute is a part of into a string supplied by the caller. When the same string is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// groupName : The output string.
+    /// Returns true if the value was successfully returned.
+    bool getGroupName(std::string& groupName) const;
+
+    /// Gets the name of the group this attribute is a part of, writing it as a null terminated string into a buffer supplied by the caller.
+    /// buffer : The output buffer. Nothing is written if the buffer is too small.
+    /// capacity : The number of characters the buffer can hold, including the terminating null.
+    /// length : The output length of the string, not including the terminating null. This is returned even when the
+    /// buffer is too small, so the call can be repeated with a buffer of at least length + 1 characters.
+    /// Returns true if the value was successfully returned or the buffer was too small. Compare length with
+    /// capacity to know if the value was written.
+    bool getGroupName(char* buffer, size_t capacity, size_t& length) const;
+
     /// Gets the name of the attribute.
     std::string name() const;
 
+    /// Gets the name of the attribute into a string supplied by the caller. When the same string is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// name : The output string.
+    /// Returns true if the value was successfully returned.
+    bool getName(std::string& name) const;
+
+    /// Gets the name of the attribute, writing it as a null terminated string into a buffer supplied by the caller.
+    /// buffer : The output buffer. Nothing is written if the buffer is too small.
+    /// capacity : The number of characters the buffer can hold, including the terminating null.
+    /// length : The output length of the string, not including the terminating null. This is returned even when the
+    /// buffer is too small, so the call can be repeated with a buffer of at least length + 1 characters.
+    /// Returns true if the value was successfully returned or the buffer was too small. Compare length with
+    /// capacity to know if the value was written.
+    bool getName(char* buffer, size_t capacity, size_t& length) const;
+
     /// Gets and sets the value of this attribute.
     /// 
     /// The size of an attribute value is limited to 2MB (2097152 bytes). If you need to
@@ -52,6 +82,21 @@ public:
     std::string value() const;
     bool value(const std::string& value);
 
+    /// Gets the value of this attribute into a string supplied by the caller. When the same string is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// value : The output string.
+    /// Returns true if the value was successfully returned.
+    bool getValue(std::string& value) const;
+
+    /// Gets the value of this attribute, writing it as a null terminated string into a buffer supplied by the caller.
+    /// buffer : The output buffer. Nothing is written if the buffer is too small.
+    /// capacity : The number of characters the buffer can hold, including the terminating null.
+    /// length : The output length of the string, not including the terminating null. This is returned even when the
+    /// buffer is too small, so the call can be repeated with a buffer of at least length + 1 characters.
+    /// Returns true if the value was successfully returned or the buffer was too small. Compare length with
+    /// capacity to know if the value was written.
+    bool getValue(char* buffer, size_t capacity, size_t& length) const;
+
     /// Returns the parent entity this attribute is associated with. This can return null
     /// in some cases. For example a BRepEdge might have been consumed by a fillet
     /// feature but can come back if the model is rolled back or the fillet is deleted.
@@ -92,6 +137,9 @@ private:
     virtual Base* parent_raw() const = 0;
     virtual bool deleteMe_raw() = 0;
     virtual ObjectCollection* otherParents_raw() const = 0;
+    virtual bool getGroupName_raw(char* buffer, size_t capacity, size_t& length) const = 0;
+    virtual bool getName_raw(char* buffer, size_t capacity, size_t& length) const = 0;
+    virtual bool getValue_raw(char* buffer, size_t capacity, size_t& length) const = 0;
 };
 
 // Inline wrappers
@@ -109,6 +157,26 @@ inline std::string Attribute::groupName() const
     return res;
 }
 
+inline bool Attribute::getGroupName(std::string& groupName) const
+{
+    size_t length = 0;
+    groupName.resize(groupName.capacity());
+    bool res = getGroupName_raw(&groupName[0], groupName.size() + 1, length);
+    if(res && length > groupName.size())
+    {
+        groupName.resize(length);
+        res = getGroupName_raw(&groupName[0], groupName.size() + 1, length);
+    }
+    groupName.resize(res ? length : 0);
+    return res;
+}
+
+inline bool Attribute::getGroupName(char* buffer, size_t capacity, size_t& length) const
+{
+    bool res = getGroupName_raw(buffer, capacity, length);
+    return res;
+}
+
 inline std::string Attribute::name() const
 {
     std::string res;
@@ -122,6 +190,26 @@ inline std::string Attribute::name() const
     return res;
 }
 
+inline bool Attribute::getName(std::string& name) const
+{
+    size_t length = 0;
+    name.resize(name.capacity());
+    bool res = getName_raw(&name[0], name.size() + 1, length);
+    if(res && length > name.size())
+    {
+        name.resize(length);
+        res = getName_raw(&name[0], name.size() + 1, length);
+    }
+    name.resize(res ? length : 0);
+    return res;
+}
+
+inline bool Attribute::getName(char* buffer, size_t capacity, size_t& length) const
+{
+    bool res = getName_raw(buffer, capacity, length);
+    return res;
+}
+
 inline std::string Attribute::value() const
 {
     std::string res;
@@ -135,6 +223,26 @@ inline std::string Attribute::value() const
     return res;
 }
 
+inline bool Attribute::getValue(std::string& value) const
+{
+    size_t length = 0;
+    value.resize(value.capacity());
+    bool res = getValue_raw(&value[0], value.size() + 1, length);
+    if(res && length > value.size())
+    {
+        value.resize(length);
+        res = getValue_raw(&value[0], value.size() + 1, length);
+    }
+    value.resize(res ? length : 0);
+    return res;
+}
+
+inline bool Attribute::getValue(char* buffer, size_t capacity, size_t& length) const
+{
+    bool res = getValue_raw(buffer, capacity, length);
+    return res;
+}
+
 inline bool Attribute::value(const std::string& value)
 {
     return value_raw(value.c_str());
@@ -73,6 +73,10 @@ public:
     /// An empty array can be returns if there are no attributes on the entity.
     std::vector<std::string> groupNames() const;
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Attribute>> asArray() const;
+
     typedef Attribute iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -90,6 +94,7 @@ private:
     virtual Attribute* add_raw(const char* groupName, const char* name, const char* value) = 0;
     virtual Attribute** itemsByGroup_raw(const char* groupName, size_t& return_size) = 0;
     virtual char** groupNames_raw(size_t& return_size) const = 0;
+    virtual Attribute** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -153,9 +158,23 @@ inline std::vector<std::string> Attributes::groupNames() const
     return res;
 }
 
+inline std::vector<Ptr<Attribute>> Attributes::asArray() const
+{
+    std::vector<Ptr<Attribute>> res;
+    size_t s;
+
+    Attribute** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void Attributes::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -0,0 +1,137 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../Base.h"
+#include "../CoreTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../OSMacros.h"
+
+#ifdef XINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CORE_BATCHERRORS_CPP__
+# define ADSK_CORE_BATCHERRORS_API XI_EXPORT
+# else
+# define ADSK_CORE_BATCHERRORS_API
+# endif
+#else
+# define ADSK_CORE_BATCHERRORS_API XI_IMPORT
+#endif
+
+namespace adsk { namespace core {
+
+/// The errors of each element of a call that works on an array of elements and carries on past the
+/// elements that fail, such as CompiledExpression.evaluateBatch. This object records which elements failed
+/// and why, in the same way getLastError does for a single call. Calls that fail as a whole, such as
+/// UnitsManager.convert with an array of values when the units aren't compatible, only set getLastError.
+///
+/// Use Application.getLastBatchErrors to get the errors of the last such call made on the current
+/// thread. The object is a snapshot, so it's unaffected by later calls.
+class BatchErrors : public Base {
+public:
+
+    /// Returns the number of elements in the call, which is the number of error codes.
+    size_t count() const;
+
+    /// Returns the number of elements that failed.
+    size_t failureCount() const;
+
+    /// Returns the error code of each element, in the order of the elements in the call. The code is
+    /// one of the GenericErrors values or a class specific error, and is 0 (Ok) for elements that succeeded.
+    std::vector<int> errorCodes() const;
+
+    /// Returns the indices of the elements that failed, in increasing order.
+    std::vector<size_t> failedIndices() const;
+
+    /// Returns information about the error of an element.
+    /// index : The index of the element within the call.
+    /// description : A description of the error in English. This is empty when the element succeeded.
+    /// Returns the error code of the element, which is 0 (Ok) if it succeeded.
+    int errorCode(size_t index, std::string* description = nullptr) const;
+
+    ADSK_CORE_BATCHERRORS_API static const char* classType();
+    ADSK_CORE_BATCHERRORS_API const char* objectType() const override;
+    ADSK_CORE_BATCHERRORS_API void* queryInterface(const char* id) const override;
+    ADSK_CORE_BATCHERRORS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual size_t count_raw() const = 0;
+    virtual size_t failureCount_raw() const = 0;
+    virtual int* errorCodes_raw(size_t& return_size) const = 0;
+    virtual size_t* failedIndices_raw(size_t& return_size) const = 0;
+    virtual int errorCode_raw(size_t index, char** description) const = 0;
+};
+
+// Inline wrappers
+
+inline size_t BatchErrors::count() const
+{
+    size_t res = count_raw();
+    return res;
+}
+
+inline size_t BatchErrors::failureCount() const
+{
+    size_t res = failureCount_raw();
+    return res;
+}
+
+inline std::vector<int> BatchErrors::errorCodes() const
+{
+    std::vector<int> res;
+    size_t s;
+
+    int* p= errorCodes_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<size_t> BatchErrors::failedIndices() const
+{
+    std::vector<size_t> res;
+    size_t s;
+
+    size_t* p= failedIndices_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline int BatchErrors::errorCode(size_t index, std::string* description) const
+{
+    char** description_ = nullptr;
+    char* description__ = nullptr;
+    if(description)
+        description_ = &description__;
+
+    int res = errorCode_raw(index, description_);
+    if(description && description__)
+    {
+        *description = description__;
+    }
+    DeallocateArray(description__);
+    return res;
+}
+}// namespace core
+}// namespace adsk
+
+#undef ADSK_CORE_BATCHERRORS_API
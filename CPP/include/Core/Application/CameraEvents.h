@@ -50,6 +50,13 @@ public:
     /// Returns true if removal of the handler was successful.
     bool remove(CameraEventHandler* handler);
 
+    /// Adds a handler that can have the firings of this event coalesced, as described on EventArgs.droppedCount.
+    /// handler : The handler object to be called when this event is fired.
+    /// isCoalescing : Specifies if the firings are coalesced for this handler. If false, the handler is added in the
+    /// same way as with the other add method.
+    /// Returns true if the addition of the handler was successful.
+    bool add(CameraEventHandler* handler, bool isCoalescing);
+
     CAMERAEVENTS_API static const char* classType();
     CAMERAEVENTS_API const char* objectType() const override;
     CAMERAEVENTS_API void* queryInterface(const char* id) const override;
@@ -60,6 +67,7 @@ private:
     // Raw interface
     virtual bool add_raw(CameraEventHandler* handler) = 0;
     virtual bool remove_raw(CameraEventHandler* handler) = 0;
+    virtual bool addWithCoalescing_raw(CameraEventHandler* handler, bool isCoalescing) = 0;
 };
 
 /// The CameraEventHandler is a client implemented class that can be added as a handler to an
@@ -106,6 +114,12 @@ inline bool CameraEvent::remove(CameraEventHandler* handler)
     return res;
 }
 
+inline bool CameraEvent::add(CameraEventHandler* handler, bool isCoalescing)
+{
+    bool res = addWithCoalescing_raw(handler, isCoalescing);
+    return res;
+}
+
 inline Ptr<Viewport> CameraEventArgs::viewport() const
 {
     Ptr<Viewport> res = viewport_raw();
@@ -0,0 +1,217 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../Base.h"
+#include "../CoreTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../OSMacros.h"
+
+#ifdef XINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CORE_COMPILEDEXPRESSION_CPP__
+# define ADSK_CORE_COMPILEDEXPRESSION_API XI_EXPORT
+# else
+# define ADSK_CORE_COMPILEDEXPRESSION_API
+# endif
+#else
+# define ADSK_CORE_COMPILEDEXPRESSION_API XI_IMPORT
+#endif
+
+namespace adsk { namespace core {
+
+/// An expression that has been parsed once so it can be evaluated many times with different values for
+/// its variables. The expression is compiled to a compact program and all of the unit conversions,
+/// including those of the variables, are resolved when it is compiled, so evaluating it only does the
+/// arithmetic. This is much faster than calling UnitsManager.evaluateExpression repeatedly when the
+/// same expression is evaluated for many sets of values, such as the rows of a design table.
+///
+/// Use UnitsManager.compileExpression to create a CompiledExpression. The object is independent of
+/// the unit preferences once compiled, so changing the default units doesn't change its results.
+class CompiledExpression : public Base {
+public:
+
+    /// Returns the expression that was compiled.
+    std::string expression() const;
+
+    /// Returns the expression standardized in terms of spacing and user preferences at the time it
+    /// was compiled. This is the string UnitsManager.standardizeExpression returns for the expression.
+    std::string standardizedExpression() const;
+
+    /// Returns the units of the result of the expression.
+    std::string units() const;
+
+    /// Returns the names of the variables in the order their values are passed to evaluate.
+    std::vector<std::string> variableNames() const;
+
+    /// Returns the number of variables, which is the number of values each evaluation takes.
+    size_t variableCount() const;
+
+    /// Evaluates the expression with a set of values of its variables.
+    /// variableValues : The value of each variable, in internal units, in the order returned by variableNames.
+    /// Returns the value of the expression in internal units. Returns NaN AND GetLastError will return
+    /// ExpressionError if the wrong number of values is given or the evaluation fails, for example by
+    /// dividing by zero. NaN is used rather than -1, which is a valid result, as evaluateBatch does.
+    double evaluate(const std::vector<double>& variableValues) const;
+
+    /// Evaluates the expression with a set of values held in an array supplied by the caller. This
+    /// doesn't allocate any memory.
+    /// variableValues : The array of values of each variable, in internal units, in the order returned by variableNames.
+    /// count : The number of values in the array, which must be the same as variableCount.
+    /// Returns the value of the expression in internal units. Returns NaN AND GetLastError will return
+    /// ExpressionError if the wrong number of values is given or the evaluation fails.
+    double evaluate(const double* variableValues, size_t count) const;
+
+    /// Evaluates the expression for many sets of values in a single call.
+    /// variableValues : The values of the variables of each evaluation, one after another. Each set holds
+    /// variableCount values in internal units, so the size must be a multiple of variableCount.
+    /// Returns the value of the expression, in internal units, for each set of values. The value is NaN for
+    /// a set whose evaluation failed and the others are still evaluated. Application.getLastBatchErrors returns
+    /// the error of each set. Returns an empty array AND GetLastError
+    /// will return ExpressionError if the size of variableValues isn't a multiple of variableCount.
+    /// When variableCount is 0 the number of evaluations can't be deduced from the values, so an empty array
+    /// is returned; use the overload that takes evaluationCount to evaluate an expression without variables.
+    std::vector<double> evaluateBatch(const std::vector<double>& variableValues) const;
+
+    /// Evaluates the expression for many sets of values in a single call, reading the values from an array
+    /// and writing the results to an array supplied by the caller. This doesn't allocate any memory.
+    /// variableValues : The values of the variables of each evaluation, one after another, with variableCount
+    /// values in internal units for each evaluation.
+    /// evaluationCount : The number of evaluations, so variableValues holds evaluationCount * variableCount values.
+    /// results : The array that receives the value of the expression for each evaluation. It must hold at least
+    /// evaluationCount values. The value is NaN for an evaluation that failed.
+    /// Returns true if all of the evaluations succeeded. Otherwise Application.getLastBatchErrors returns the
+    /// error of each evaluation.
+    bool evaluateBatch(const double* variableValues, size_t evaluationCount, double* results) const;
+
+    ADSK_CORE_COMPILEDEXPRESSION_API static const char* classType();
+    ADSK_CORE_COMPILEDEXPRESSION_API const char* objectType() const override;
+    ADSK_CORE_COMPILEDEXPRESSION_API void* queryInterface(const char* id) const override;
+    ADSK_CORE_COMPILEDEXPRESSION_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual char* expression_raw() const = 0;
+    virtual char* standardizedExpression_raw() const = 0;
+    virtual char* units_raw() const = 0;
+    virtual char** variableNames_raw(size_t& return_size) const = 0;
+    virtual size_t variableCount_raw() const = 0;
+    virtual double evaluate_raw(const double* variableValues, size_t count) const = 0;
+    virtual double* evaluateBatch_raw(const double* variableValues, size_t variableValues_size, size_t& return_size) const = 0;
+    virtual bool evaluateBatch_raw(const double* variableValues, size_t evaluationCount, double* results) const = 0;
+};
+
+// Inline wrappers
+
+inline std::string CompiledExpression::expression() const
+{
+    std::string res;
+
+    char* p= expression_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::string CompiledExpression::standardizedExpression() const
+{
+    std::string res;
+
+    char* p= standardizedExpression_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::string CompiledExpression::units() const
+{
+    std::string res;
+
+    char* p= units_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<std::string> CompiledExpression::variableNames() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= variableNames_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            DeallocateArray(pChar);
+        }
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline size_t CompiledExpression::variableCount() const
+{
+    size_t res = variableCount_raw();
+    return res;
+}
+
+inline double CompiledExpression::evaluate(const std::vector<double>& variableValues) const
+{
+    double res = evaluate_raw(variableValues.data(), variableValues.size());
+    return res;
+}
+
+inline double CompiledExpression::evaluate(const double* variableValues, size_t count) const
+{
+    double res = evaluate_raw(variableValues, count);
+    return res;
+}
+
+inline std::vector<double> CompiledExpression::evaluateBatch(const std::vector<double>& variableValues) const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= evaluateBatch_raw(variableValues.data(), variableValues.size(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool CompiledExpression::evaluateBatch(const double* variableValues, size_t evaluationCount, double* results) const
+{
+    bool res = evaluateBatch_raw(variableValues, evaluationCount, results);
+    return res;
+}
+}// namespace core
+}// namespace adsk
+
+#undef ADSK_CORE_COMPILEDEXPRESSION_API
@@ -12,6 +12,7 @@
 #include "Events.h"
 #include "EventHandler.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -38,6 +39,11 @@ namespace adsk { namespace core {
 /// to your add-in, which is running in the primary thread. It's also possible for add-ins to
 /// cooperate and another add-in can trigger this event in your add-in by knowing the custom
 /// event id.
+///
+/// Each custom event has its own lock-free queue of fired events, so any number of threads can
+/// fire it without blocking each other or the primary thread. When a handler is notified, the
+/// pending fires are coalesced into a single notification that carries the additional information
+/// of each of them, up to maximumBatchSize; maximumRate limits how often the handlers are notified.
 class CustomEvent : public Event {
 public:
 
@@ -55,6 +61,19 @@ public:
     /// custom event has it's own unique id.
     std::string eventId() const;
 
+    /// Gets and sets the maximum number of fires that are delivered in one notification. When more
+    /// fires are pending, they are delivered in further notifications. The default is 1, which
+    /// notifies the handlers once for each fire. Setting a value of 0 fails.
+    size_t maximumBatchSize() const;
+    bool maximumBatchSize(size_t value);
+
+    /// Gets and sets the maximum number of times per second the handlers of this event are notified.
+    /// Fires that arrive sooner are held and delivered together in the next notification, so a
+    /// worker that reports progress many times per second doesn't flood the primary thread. The
+    /// default is 0, which doesn't limit the rate.
+    double maximumRate() const;
+    bool maximumRate(double value);
+
     CUSTOMEVENTS_API static const char* classType();
     CUSTOMEVENTS_API const char* objectType() const override;
     CUSTOMEVENTS_API void* queryInterface(const char* id) const override;
@@ -66,6 +85,10 @@ private:
     virtual bool add_raw(CustomEventHandler* handler) = 0;
     virtual bool remove_raw(CustomEventHandler* handler) = 0;
     virtual char* eventId_raw() const = 0;
+    virtual size_t maximumBatchSize_raw() const = 0;
+    virtual bool maximumBatchSize_raw(size_t value) = 0;
+    virtual double maximumRate_raw() const = 0;
+    virtual bool maximumRate_raw(double value) = 0;
 };
 
 /// The ApplicationEventArgs provides information associated with an application event.
@@ -74,9 +97,15 @@ class CustomEventArgs : public EventArgs {
 public:
 
     /// Information being passed to the add-in in the primary thread from the worker thread
-    /// or other add-in.
+    /// or other add-in. When the notification carries more than one fire, this is the information
+    /// of the most recent one.
     std::string additionalInfo() const;
 
+    /// Returns the information passed with each of the fires delivered by this notification, in the
+    /// order they were fired. There is more than one when the maximumBatchSize of the event is greater
+    /// than 1 and several fires were pending.
+    std::vector<std::string> additionalInfos() const;
+
     CUSTOMEVENTS_API static const char* classType();
     CUSTOMEVENTS_API const char* objectType() const override;
     CUSTOMEVENTS_API void* queryInterface(const char* id) const override;
@@ -86,6 +115,7 @@ private:
 
     // Raw interface
     virtual char* additionalInfo_raw() const = 0;
+    virtual char** additionalInfos_raw(size_t& return_size) const = 0;
 };
 
 /// The ApplicationEventHandler is a client implemented class that can be added as a handler to an
@@ -125,6 +155,28 @@ inline std::string CustomEvent::eventId() const
     return res;
 }
 
+inline size_t CustomEvent::maximumBatchSize() const
+{
+    size_t res = maximumBatchSize_raw();
+    return res;
+}
+
+inline bool CustomEvent::maximumBatchSize(size_t value)
+{
+    return maximumBatchSize_raw(value);
+}
+
+inline double CustomEvent::maximumRate() const
+{
+    double res = maximumRate_raw();
+    return res;
+}
+
+inline bool CustomEvent::maximumRate(double value)
+{
+    return maximumRate_raw(value);
+}
+
 inline std::string CustomEventArgs::additionalInfo() const
 {
     std::string res;
@@ -137,6 +189,27 @@ inline std::string CustomEventArgs::additionalInfo() const
     }
     return res;
 }
+
+inline std::vector<std::string> CustomEventArgs::additionalInfos() const
+{
+    std::vector<std::string> res;
+    size_t s;
+
+    char** p= additionalInfos_raw(s);
+    if(p)
+    {
+        res.resize(s);
+        for(size_t i=0; i<s; ++i)
+        {
+            char* pChar = p[i];
+            if(pChar)
+                res[i] = pChar;
+            DeallocateArray(pChar);
+        }
+        DeallocateArray(p);
+    }
+    return res;
+}
 }// namespace core
 }// namespace adsk
 
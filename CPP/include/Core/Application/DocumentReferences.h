@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -44,6 +45,10 @@ public:
     /// The number of DocumentReference objects in this collection.
     size_t count() const;
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<DocumentReference>> asArray() const;
+
     typedef DocumentReference iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -57,6 +62,7 @@ private:
     // Raw interface
     virtual DocumentReference* item_raw(size_t index) const = 0;
     virtual size_t count_raw() const = 0;
+    virtual DocumentReference** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -73,9 +79,23 @@ inline size_t DocumentReferences::count() const
     return res;
 }
 
+inline std::vector<Ptr<DocumentReference>> DocumentReferences::asArray() const
+{
+    std::vector<Ptr<DocumentReference>> res;
+    size_t s;
+
+    DocumentReference** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void DocumentReferences::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
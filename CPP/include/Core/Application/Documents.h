@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -63,6 +64,10 @@ public:
     /// Returns the open document or null if the open failed.
     Ptr<Document> open(const Ptr<DataFile>& dataFile, bool visible = true);
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Document>> asArray() const;
+
     typedef Document iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -78,6 +83,7 @@ private:
     virtual Document* item_raw(size_t index) const = 0;
     virtual size_t count_raw() const = 0;
     virtual Document* open_raw(DataFile* dataFile, bool visible) = 0;
+    virtual Document** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -106,9 +112,23 @@ inline Ptr<Document> Documents::open(const Ptr<DataFile>& dataFile, bool visible
     return res;
 }
 
+inline std::vector<Ptr<Document>> Documents::asArray() const
+{
+    std::vector<Ptr<Document>> res;
+    size_t s;
+
+    Document** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void Documents::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
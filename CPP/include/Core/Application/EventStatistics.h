@@ -0,0 +1,319 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../Base.h"
+#include "../CoreTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../OSMacros.h"
+
+#ifdef XINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CORE_EVENTSTATISTICS_CPP__
+# define ADSK_CORE_EVENTSTATISTICS_API XI_EXPORT
+# else
+# define ADSK_CORE_EVENTSTATISTICS_API
+# endif
+#else
+# define ADSK_CORE_EVENTSTATISTICS_API XI_IMPORT
+#endif
+
+namespace adsk { namespace core {
+    class Event;
+    class EventHandler;
+    class EventHandlerStatistics;
+}}
+
+namespace adsk { namespace core {
+
+/// Provides access to the measurements Fusion takes of every event handler added through the API. Each
+/// time an event notifies a handler, of any event type including custom events, the call is counted and
+/// timed against the handler. The timing covers the notify call only, so time spent by the handler in
+/// work it starts and returns from immediately isn't included.
+///
+/// A call that takes longer than slowHandlerThreshold is counted as a slow call and a warning naming the
+/// add-in, the event and the time taken is written to the log. Because the measurements are kept per
+/// handler, they show which add-in is responsible when Fusion becomes unresponsive while events fire.
+///
+/// Use Application.eventStatistics to get this object.
+class EventStatistics : public Base {
+public:
+
+    /// Gets and sets if handler calls are being measured. Turning this off stops new measurements but
+    /// keeps those already taken. The default is true.
+    bool isEnabled() const;
+    bool isEnabled(bool value);
+
+    /// Gets and sets the time, in seconds, a handler call must take to be counted as a slow call and be
+    /// reported in the log. Setting it to 0 turns off the warnings. The default is 0.1 seconds.
+    double slowHandlerThreshold() const;
+    bool slowHandlerThreshold(double value);
+
+    /// Returns the upper bound, in seconds, of each bucket of the latency histograms returned by
+    /// EventHandlerStatistics.latencyHistogram. The buckets are in increasing order and there is one
+    /// more bucket than there are bounds, which counts the calls that took longer than the last bound.
+    std::vector<double> histogramBounds() const;
+
+    /// Returns the statistics for each of the handlers that has been called at least once since the
+    /// statistics were last reset. Handlers that have been removed from their event are still returned.
+    std::vector<Ptr<EventHandlerStatistics>> handlers() const;
+
+    /// Returns the statistics for the handlers of the specified event that have been called at least
+    /// once since the statistics were last reset.
+    /// event : The event to get the handler statistics of.
+    std::vector<Ptr<EventHandlerStatistics>> handlersOfEvent(const Ptr<Event>& event) const;
+
+    /// Clears all of the measurements and the recorded trace.
+    /// Returns true if successful.
+    bool reset();
+
+    /// Writes the most recent handler calls to a file in the Trace Event Format, which can be opened
+    /// by trace viewers such as the one in Chromium based browsers or Perfetto. Each call is written
+    /// as a complete event named by the event and the add-in, on the thread the handler was called on.
+    /// The most recent 100,000 calls are kept.
+    /// filename : The full path of the JSON file to write. An existing file is overwritten.
+    /// Returns true if the file was written successfully.
+    bool exportTrace(const std::string& filename) const;
+
+    ADSK_CORE_EVENTSTATISTICS_API static const char* classType();
+    ADSK_CORE_EVENTSTATISTICS_API const char* objectType() const override;
+    ADSK_CORE_EVENTSTATISTICS_API void* queryInterface(const char* id) const override;
+    ADSK_CORE_EVENTSTATISTICS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual bool isEnabled_raw() const = 0;
+    virtual bool isEnabled_raw(bool value) = 0;
+    virtual double slowHandlerThreshold_raw() const = 0;
+    virtual bool slowHandlerThreshold_raw(double value) = 0;
+    virtual double* histogramBounds_raw(size_t& return_size) const = 0;
+    virtual EventHandlerStatistics** handlers_raw(size_t& return_size) const = 0;
+    virtual EventHandlerStatistics** handlersOfEvent_raw(Event* event, size_t& return_size) const = 0;
+    virtual bool reset_raw() = 0;
+    virtual bool exportTrace_raw(const char* filename) const = 0;
+};
+
+/// The measurements taken of the calls made to a single event handler. The values are a snapshot taken
+/// when this object was returned and don't change as the handler continues to be called. Use
+/// EventStatistics.handlers to get new values.
+class EventHandlerStatistics : public Base {
+public:
+
+    /// Returns the event the handler was added to.
+    Ptr<Event> event() const;
+
+    /// Returns the name of the event the handler was added to, for example "DocumentOpened". This is
+    /// still available when the event itself no longer exists.
+    std::string eventName() const;
+
+    /// Returns the name of the add-in or script that added the handler.
+    std::string addInName() const;
+
+    /// Returns the handler the measurements were taken of. Use this to find the statistics of the
+    /// handlers your own add-in has added. This returns null when the handler has been removed from its
+    /// event, because the object may have been deleted.
+    EventHandler* handler() const;
+
+    /// Returns the number of times the handler has been called.
+    size_t callCount() const;
+
+    /// Returns the total time, in seconds, spent in calls to the handler.
+    double totalTime() const;
+
+    /// Returns the time, in seconds, of the longest call to the handler.
+    double maximumTime() const;
+
+    /// Returns the number of calls to the handler that took longer than EventStatistics.slowHandlerThreshold.
+    size_t slowCallCount() const;
+
+    /// Returns the number of calls to the handler that fell in each bucket of the latency histogram. The
+    /// bounds of the buckets are returned by EventStatistics.histogramBounds.
+    std::vector<size_t> latencyHistogram() const;
+
+    ADSK_CORE_EVENTSTATISTICS_API static const char* classType();
+    ADSK_CORE_EVENTSTATISTICS_API const char* objectType() const override;
+    ADSK_CORE_EVENTSTATISTICS_API void* queryInterface(const char* id) const override;
+    ADSK_CORE_EVENTSTATISTICS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual Event* event_raw() const = 0;
+    virtual char* eventName_raw() const = 0;
+    virtual char* addInName_raw() const = 0;
+    virtual EventHandler* handler_raw() const = 0;
+    virtual size_t callCount_raw() const = 0;
+    virtual double totalTime_raw() const = 0;
+    virtual double maximumTime_raw() const = 0;
+    virtual size_t slowCallCount_raw() const = 0;
+    virtual size_t* latencyHistogram_raw(size_t& return_size) const = 0;
+};
+
+// Inline wrappers
+
+inline bool EventStatistics::isEnabled() const
+{
+    bool res = isEnabled_raw();
+    return res;
+}
+
+inline bool EventStatistics::isEnabled(bool value)
+{
+    return isEnabled_raw(value);
+}
+
+inline double EventStatistics::slowHandlerThreshold() const
+{
+    double res = slowHandlerThreshold_raw();
+    return res;
+}
+
+inline bool EventStatistics::slowHandlerThreshold(double value)
+{
+    return slowHandlerThreshold_raw(value);
+}
+
+inline std::vector<double> EventStatistics::histogramBounds() const
+{
+    std::vector<double> res;
+    size_t s;
+
+    double* p= histogramBounds_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<Ptr<EventHandlerStatistics>> EventStatistics::handlers() const
+{
+    std::vector<Ptr<EventHandlerStatistics>> res;
+    size_t s;
+
+    EventHandlerStatistics** p= handlers_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::vector<Ptr<EventHandlerStatistics>> EventStatistics::handlersOfEvent(const Ptr<Event>& event) const
+{
+    std::vector<Ptr<EventHandlerStatistics>> res;
+    size_t s;
+
+    EventHandlerStatistics** p= handlersOfEvent_raw(event.get(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool EventStatistics::reset()
+{
+    bool res = reset_raw();
+    return res;
+}
+
+inline bool EventStatistics::exportTrace(const std::string& filename) const
+{
+    bool res = exportTrace_raw(filename.c_str());
+    return res;
+}
+
+inline Ptr<Event> EventHandlerStatistics::event() const
+{
+    Ptr<Event> res = event_raw();
+    return res;
+}
+
+inline std::string EventHandlerStatistics::eventName() const
+{
+    std::string res;
+
+    char* p= eventName_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::string EventHandlerStatistics::addInName() const
+{
+    std::string res;
+
+    char* p= addInName_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline EventHandler* EventHandlerStatistics::handler() const
+{
+    EventHandler* res = handler_raw();
+    return res;
+}
+
+inline size_t EventHandlerStatistics::callCount() const
+{
+    size_t res = callCount_raw();
+    return res;
+}
+
+inline double EventHandlerStatistics::totalTime() const
+{
+    double res = totalTime_raw();
+    return res;
+}
+
+inline double EventHandlerStatistics::maximumTime() const
+{
+    double res = maximumTime_raw();
+    return res;
+}
+
+inline size_t EventHandlerStatistics::slowCallCount() const
+{
+    size_t res = slowCallCount_raw();
+    return res;
+}
+
+inline std::vector<size_t> EventHandlerStatistics::latencyHistogram() const
+{
+    std::vector<size_t> res;
+    size_t s;
+
+    size_t* p= latencyHistogram_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace core
+}// namespace adsk
+
+#undef ADSK_CORE_EVENTSTATISTICS_API
@@ -97,6 +97,17 @@ public:
     /// The event that the firing is in response to.
     Ptr<Event> firingEvent() const;
 
+    /// Returns the number of firings that were replaced by this one since the handler was last notified,
+    /// and so never reached the handler. This is always 0 unless the handler was added to the event as a
+    /// coalescing handler, with the add method of MouseEvent, CameraEvent or ActiveSelectionEvent that
+    /// takes isCoalescing.
+    /// 
+    /// A coalescing handler is notified at most once per frame of the graphics display, with the arguments
+    /// of the most recent firing. When the display isn't being redrawn, firings are held for no longer than
+    /// the frame time set by GraphicsPreferences.minimumFramesPerSecond. Coalescing only applies to that
+    /// handler, so the other handlers of the event are still notified of every firing.
+    size_t droppedCount() const;
+
     EVENTS_API static const char* classType();
     EVENTS_API const char* objectType() const override;
     EVENTS_API void* queryInterface(const char* id) const override;
@@ -106,7 +117,7 @@ private:
 
     // Raw interface
     virtual Event* firingEvent_raw() const = 0;
-    virtual void placeholderEventArgs0() {}
+    virtual size_t droppedCount_raw() const = 0;
     virtual void placeholderEventArgs1() {}
     virtual void placeholderEventArgs2() {}
     virtual void placeholderEventArgs3() {}
@@ -165,6 +176,12 @@ inline Ptr<Event> EventArgs::firingEvent() const
     Ptr<Event> res = firingEvent_raw();
     return res;
 }
+
+inline size_t EventArgs::droppedCount() const
+{
+    size_t res = droppedCount_raw();
+    return res;
+}
 }// namespace core
 }// namespace adsk
 
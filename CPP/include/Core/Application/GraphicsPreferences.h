@@ -32,7 +32,8 @@ namespace adsk { namespace core {
 class GraphicsPreferences : public Base {
 public:
 
-    /// Gets and sets the minimum frames per second.
+    /// Gets and sets the minimum frames per second. This also sets the longest time the firings of an event
+    /// are held before a coalescing handler is notified, see EventArgs.droppedCount.
     double minimumFramesPerSecond() const;
     bool minimumFramesPerSecond(double value);
 
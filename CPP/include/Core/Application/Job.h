@@ -0,0 +1,183 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../Base.h"
+#include "../CoreTypeDefs.h"
+#include <string>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../OSMacros.h"
+
+#ifdef XINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CORE_JOB_CPP__
+# define ADSK_CORE_JOB_API XI_EXPORT
+# else
+# define ADSK_CORE_JOB_API
+# endif
+#else
+# define ADSK_CORE_JOB_API XI_IMPORT
+#endif
+
+namespace adsk { namespace core {
+    class JobEvent;
+}}
+
+namespace adsk { namespace core {
+
+/// Represents a job that Fusion 360 is running in the background, such as the upload of a document or a
+/// translation. Use Application.activeJobs to get the jobs that are running. A Job remains valid after the job
+/// has completed, so the result of the job can still be checked.
+class Job : public Base {
+public:
+
+    /// Returns the unique identifier of the job.
+    std::string id() const;
+
+    /// Returns the type of the job.
+    JobTypes jobType() const;
+
+    /// Returns a description of the job, in the language of the user interface, like the one shown in the Job
+    /// Status dialog.
+    std::string description() const;
+
+    /// Returns the object the job is working on, such as the Document being uploaded or the DataFile being
+    /// translated. Returns null if the job isn't working on an object the API can return.
+    Ptr<Base> target() const;
+
+    /// Returns the progress of the job, from 0 to 1. Returns -1 if the job doesn't report its progress.
+    double progress() const;
+
+    /// Returns the estimated time, in seconds, until the job completes. This is worked out from the progress the
+    /// job has made so far and can change a lot, especially early in the job. Returns -1 if there isn't an estimate.
+    double estimatedTimeRemaining() const;
+
+    /// Returns true if the job has completed, whether it succeeded or not.
+    bool isComplete() const;
+
+    /// Returns true if the job has completed successfully.
+    bool isSuccess() const;
+
+    /// Returns a description of the error if the job has failed. Returns an empty string if the job is still
+    /// running or has succeeded.
+    std::string errorDescription() const;
+
+    /// The completed event fires when this job completes, whether it succeeded or not. If the job has already
+    /// completed when a handler is added, the event fires for that handler when Fusion next processes messages, so
+    /// the handler is always called once.
+    Ptr<JobEvent> completed() const;
+
+    ADSK_CORE_JOB_API static const char* classType();
+    ADSK_CORE_JOB_API const char* objectType() const override;
+    ADSK_CORE_JOB_API void* queryInterface(const char* id) const override;
+    ADSK_CORE_JOB_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual char* id_raw() const = 0;
+    virtual JobTypes jobType_raw() const = 0;
+    virtual char* description_raw() const = 0;
+    virtual Base* target_raw() const = 0;
+    virtual double progress_raw() const = 0;
+    virtual double estimatedTimeRemaining_raw() const = 0;
+    virtual bool isComplete_raw() const = 0;
+    virtual bool isSuccess_raw() const = 0;
+    virtual char* errorDescription_raw() const = 0;
+    virtual JobEvent* completed_raw() const = 0;
+};
+
+// Inline wrappers
+
+inline std::string Job::id() const
+{
+    std::string res;
+
+    char* p= id_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline JobTypes Job::jobType() const
+{
+    JobTypes res = jobType_raw();
+    return res;
+}
+
+inline std::string Job::description() const
+{
+    std::string res;
+
+    char* p= description_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline Ptr<Base> Job::target() const
+{
+    Ptr<Base> res = target_raw();
+    return res;
+}
+
+inline double Job::progress() const
+{
+    double res = progress_raw();
+    return res;
+}
+
+inline double Job::estimatedTimeRemaining() const
+{
+    double res = estimatedTimeRemaining_raw();
+    return res;
+}
+
+inline bool Job::isComplete() const
+{
+    bool res = isComplete_raw();
+    return res;
+}
+
+inline bool Job::isSuccess() const
+{
+    bool res = isSuccess_raw();
+    return res;
+}
+
+inline std::string Job::errorDescription() const
+{
+    std::string res;
+
+    char* p= errorDescription_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline Ptr<JobEvent> Job::completed() const
+{
+    Ptr<JobEvent> res = completed_raw();
+    return res;
+}
+}// namespace core
+}// namespace adsk
+
+#undef ADSK_CORE_JOB_API
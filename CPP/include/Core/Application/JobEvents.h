@@ -0,0 +1,114 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "Events.h"
+#include "EventHandler.h"
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../OSMacros.h"
+
+#ifdef XINTERFACE_EXPORTS
+# ifdef __COMPILING_JOBEVENTS_CPP__
+# define JOBEVENTS_API XI_EXPORT
+# else
+# define JOBEVENTS_API
+# endif
+#else
+# define JOBEVENTS_API XI_IMPORT
+#endif
+
+namespace adsk { namespace core {
+    class Job;
+    class JobEventArgs;
+    class JobEventHandler;
+}}
+
+namespace adsk { namespace core {
+
+/// A JobEvent represents an event related to a background job. For example, Job.completed.
+class JobEvent : public Event {
+public:
+
+    /// Add a handler to be notified when the event occurs.
+    /// handler : The handler object to be called when this event is fired.
+    /// Returns true if the addition of the handler was successful.
+    bool add(JobEventHandler* handler);
+
+    /// Removes a handler from the event.
+    /// handler : The handler object to be removed from the event.
+    /// Returns true if removal of the handler was successful.
+    bool remove(JobEventHandler* handler);
+
+    JOBEVENTS_API static const char* classType();
+    JOBEVENTS_API const char* objectType() const override;
+    JOBEVENTS_API void* queryInterface(const char* id) const override;
+    JOBEVENTS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual bool add_raw(JobEventHandler* handler) = 0;
+    virtual bool remove_raw(JobEventHandler* handler) = 0;
+};
+
+/// The JobEventArgs provides information associated with a job event.
+class JobEventArgs : public EventArgs {
+public:
+
+    /// Returns the job the event is for. Use the isSuccess and errorDescription properties of the job to
+    /// get its result.
+    Ptr<Job> job() const;
+
+    JOBEVENTS_API static const char* classType();
+    JOBEVENTS_API const char* objectType() const override;
+    JOBEVENTS_API void* queryInterface(const char* id) const override;
+    JOBEVENTS_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual Job* job_raw() const = 0;
+};
+
+/// The JobEventHandler is a client implemented class that can be added as a handler to a
+/// JobEvent.
+class JobEventHandler : public EventHandler {
+public:
+
+    /// The function called by Fusion 360 when the associated event is fired.
+    /// eventArgs : Returns an object that provides access to additional information associated with the event.
+    JOBEVENTS_API virtual void notify(const Ptr<JobEventArgs>& eventArgs) = 0;
+};
+
+// Inline wrappers
+
+inline bool JobEvent::add(JobEventHandler* handler)
+{
+    bool res = add_raw(handler);
+    return res;
+}
+
+inline bool JobEvent::remove(JobEventHandler* handler)
+{
+    bool res = remove_raw(handler);
+    return res;
+}
+
+inline Ptr<Job> JobEventArgs::job() const
+{
+    Ptr<Job> res = job_raw();
+    return res;
+}
+}// namespace core
+}// namespace adsk
+
+#undef JOBEVENTS_API
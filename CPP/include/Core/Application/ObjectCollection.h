@@ -11,6 +11,9 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
+#include <iterator>
+#include <type_traits>
 #include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
@@ -47,6 +50,13 @@ public:
     /// Returns false if the item was not added.
     bool add(const Ptr<Base>& item);
 
+    /// Adds an array of objects to the end of the collection using a single call. The storage of the
+    /// collection is grown once for all of the items, which is much faster than calling add for each item.
+    /// Duplicates can be added to the collection.
+    /// items : The items to add to the list.
+    /// Returns false if the items were not added, in which case the collection is unchanged.
+    bool addArray(const std::vector<Ptr<Base>>& items);
+
     /// Function that removes an item from the collection.
     /// item : The object to remove from the collection.
     /// Returns true if the removal was successful.
@@ -108,9 +118,17 @@ public:
     /// Returns an array of the Fusion objects in the ObjectCollection.
     std::vector<Ptr<Base>> asArray() const;
 
+    /// Gets the content of the ObjectCollection into an array supplied by the caller. The collection writes
+    /// its items into a temporary buffer on the caller's side, without allocating an array of its own, and
+    /// the reference it returns for each item is moved into the array rather than copied. When the same
+    /// array is passed to repeated calls, its storage is reused.
+    /// items : The output array of the Fusion objects in the ObjectCollection.
+    /// Returns true if the items were successfully returned.
+    bool asArray(std::vector<Ptr<Base>>& items) const;
+
     typedef Base iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
-    template <class Container> static Ptr<ObjectCollection> create(Container container);
+    template <class Container> static Ptr<ObjectCollection> create(const Container& container);
     template <class InputIterator> static Ptr<ObjectCollection> create(InputIterator first, InputIterator last);
 
     ADSK_CORE_OBJECTCOLLECTION_API static const char* classType();
@@ -132,6 +150,14 @@ private:
     ADSK_CORE_OBJECTCOLLECTION_API static ObjectCollection* create_raw();
     ADSK_CORE_OBJECTCOLLECTION_API static ObjectCollection* createWithArray_raw(Base** array, size_t array_size);
     virtual Base** asArray_raw(size_t& return_size) const = 0;
+    virtual bool addArray_raw(Base** items, size_t items_size) = 0;
+    virtual bool asArrayToBuffer_raw(Base** items, size_t capacity, size_t& count) const = 0;
+
+    template <class U> static Base* rawItem(const Ptr<U>& item) { return item.get(); }
+    template <class U> static std::true_type isPtrItem(const Ptr<U>*);
+    static std::false_type isPtrItem(const void*);
+    template <class ForwardIterator> static Ptr<ObjectCollection> createFromRange(ForwardIterator first, ForwardIterator last, std::true_type);
+    template <class InputIterator> static Ptr<ObjectCollection> createFromRange(InputIterator first, InputIterator last, std::false_type);
 };
 
 // Inline wrappers
@@ -154,6 +180,16 @@ inline bool ObjectCollection::add(const Ptr<Base>& item)
     return res;
 }
 
+inline bool ObjectCollection::addArray(const std::vector<Ptr<Base>>& items)
+{
+    ScratchArray<Base*> items_(items.size());
+    for(size_t i=0; i<items.size(); ++i)
+        items_[i] = items[i].get();
+
+    bool res = addArray_raw(items_, items.size());
+    return res;
+}
+
 inline bool ObjectCollection::removeByItem(const Ptr<Base>& item)
 {
     bool res = removeByItem_raw(item.get());
@@ -192,12 +228,11 @@ inline Ptr<ObjectCollection> ObjectCollection::create()
 
 inline Ptr<ObjectCollection> ObjectCollection::createWithArray(const std::vector<Ptr<Base>>& array)
 {
-    Base** array_ = new Base*[array.size()];
+    ScratchArray<Base*> array_(array.size());
     for(size_t i=0; i<array.size(); ++i)
         array_[i] = array[i].get();
 
     Ptr<ObjectCollection> res = createWithArray_raw(array_, array.size());
-    delete[] array_;
     return res;
 }
 
@@ -215,27 +250,85 @@ inline std::vector<Ptr<Base>> ObjectCollection::asArray() const
     return res;
 }
 
+inline bool ObjectCollection::asArray(std::vector<Ptr<Base>>& items) const
+{
+    size_t capacity = count_raw();
+    size_t count = 0;
+    ScratchArray<Base*> items_(capacity);
+    if(asArrayToBuffer_raw(items_, capacity, count) && count <= capacity)
+    {
+        items.clear();
+        items.reserve(count);
+        for(size_t i=0; i<count; ++i)
+            items.emplace_back(items_[i]);
+        return true;
+    }
+
+    size_t s;
+
+    Base** p= asArray_raw(s);
+    if(!p)
+    {
+        items.clear();
+        return false;
+    }
+    items.assign(p, p+s);
+    DeallocateArray(p);
+    return true;
+}
+
 template <class OutputIterator> inline void ObjectCollection::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
     }
 }
 
-template <class Container> inline Ptr<ObjectCollection> ObjectCollection::create(Container container)
+template <class Container> inline Ptr<ObjectCollection> ObjectCollection::create(const Container& container)
 {
    return create(container.begin(), container.end());
 }
 
 template <class InputIterator> inline Ptr<ObjectCollection> ObjectCollection::create(InputIterator first, InputIterator last)
 {
-    Ptr<ObjectCollection> list = create();
-    if (list)
-        for (;first != last;++first)
-            list->add(*first);
-    return list;
+    // When the items are Ptrs that can be referenced in place, their raw pointers are passed to the
+    // collection in a single call. Items that an iterator returns by value, and ranges of raw pointers,
+    // which the Ptrs of a temporary array take ownership of, go through createWithArray. Null items are
+    // skipped, as they were when the items were added one at a time, because a single null item makes
+    // the collection reject the whole array.
+    typedef std::iterator_traits<InputIterator> traits;
+    typedef decltype(isPtrItem(static_cast<const typename traits::value_type*>(nullptr))) isPtrRange;
+    typedef std::integral_constant<bool, isPtrRange::value && std::is_reference<typename traits::reference>::value &&
+        std::is_base_of<std::forward_iterator_tag, typename traits::iterator_category>::value> isInPlace;
+    return createFromRange(first, last, isInPlace());
+}
+
+template <class ForwardIterator> inline Ptr<ObjectCollection> ObjectCollection::createFromRange(ForwardIterator first, ForwardIterator last, std::true_type)
+{
+    ScratchArray<Base*> array_(static_cast<size_t>(std::distance(first, last)));
+    size_t array_size = 0;
+    for (;first != last;++first)
+    {
+        if (Base* item = rawItem(*first))
+            array_[array_size++] = item;
+    }
+
+    Ptr<ObjectCollection> res = createWithArray_raw(array_, array_size);
+    return res;
+}
+
+template <class InputIterator> inline Ptr<ObjectCollection> ObjectCollection::createFromRange(InputIterator first, InputIterator last, std::false_type)
+{
+    std::vector<Ptr<Base>> array;
+    for (;first != last;++first)
+    {
+        Ptr<Base> item(*first);
+        if (item)
+            array.push_back(std::move(item));
+    }
+    return createWithArray(array);
 }
 }// namespace core
 }// namespace adsk
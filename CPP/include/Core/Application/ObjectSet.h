@@ -0,0 +1,283 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../Base.h"
+#include "ObjectCollection.h"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+// THIS CLASS IS USED BY AN API CLIENT
+
+namespace adsk { namespace core {
+
+/// A set of Fusion objects with constant time membership tests, insertion and removal. It is a
+/// companion to ObjectCollection for the cases where ObjectCollection::contains, find and
+/// removeByItem would have to search the whole collection, such as removing duplicates from a
+/// selection or building the set of faces touched by an operation.
+///
+/// Objects are compared the same way Ptr compares them, by identity. Each object is held only
+/// once, and iterating the set visits the objects in the order they were first inserted.
+///
+///     ObjectSet<BRepFace> faces;
+///     for (Ptr<BRepEdge> edge : view(edges))
+///         for (Ptr<BRepFace> face : view(edge->faces()))
+///             faces.insert(face);
+///     Ptr<ObjectCollection> result = faces.toObjectCollection();
+template <class T = Base>
+class ObjectSet {
+public:
+
+    typedef Ptr<T> value_type;
+    typedef size_t size_type;
+
+    /// Forward iterator over the objects of the set in insertion order.
+    class const_iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename ObjectSet::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef const value_type& reference;
+
+        const_iterator() : m_items(nullptr), m_index(0) {}
+        const_iterator(const std::vector<value_type>* items, size_t index) : m_items(items), m_index(index) { skipRemoved(); }
+
+        reference operator*() const { return (*m_items)[m_index]; }
+        pointer operator->() const { return &(*m_items)[m_index]; }
+
+        const_iterator& operator++() { ++m_index; skipRemoved(); return *this; }
+        const_iterator operator++(int) { const_iterator tmp(*this); ++*this; return tmp; }
+
+        bool operator==(const const_iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const const_iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        void skipRemoved()
+        {
+            while (m_items && m_index < m_items->size() && !(*m_items)[m_index])
+                ++m_index;
+        }
+
+        const std::vector<value_type>* m_items;
+        size_t m_index;
+    };
+    typedef const_iterator iterator;
+
+    /// Creates an empty set.
+    ObjectSet() : m_removed(0) {}
+
+    /// Creates a set from the objects in an ObjectCollection. The objects are retrieved with a single
+    /// call to asArray and duplicates are dropped.
+    /// collection : The collection to copy. A null collection results in an empty set.
+    explicit ObjectSet(const Ptr<ObjectCollection>& collection) : m_removed(0)
+    {
+        if (collection)
+            insert(collection->asArray());
+    }
+
+    /// Creates a set from an array of objects. Duplicates are dropped.
+    template <class U>
+    explicit ObjectSet(const std::vector<Ptr<U>>& objects) : m_removed(0)
+    {
+        insert(objects);
+    }
+
+    /// Returns the number of objects in the set.
+    size_t size() const { return m_index.size(); }
+
+    /// Returns true if the set has no objects.
+    bool empty() const { return m_index.empty(); }
+
+    /// Reserves space for the specified number of objects.
+    void reserve(size_t count)
+    {
+        m_items.reserve(count);
+        m_index.reserve(count);
+    }
+
+    /// Returns true if the object is in the set.
+    bool contains(const Ptr<T>& object) const
+    {
+        return m_index.find(object.get()) != m_index.end();
+    }
+
+    /// Adds an object to the end of the set if it isn't already in it.
+    /// object : The object to add. Null objects are ignored.
+    /// Returns true if the object was added, or false if it was null or already in the set.
+    bool insert(const Ptr<T>& object)
+    {
+        if (!object)
+            return false;
+        if (!m_index.insert(std::make_pair(object.get(), m_items.size())).second)
+            return false;
+        m_items.push_back(object);
+        return true;
+    }
+
+    /// Adds each object of an array that isn't already in the set.
+    /// Returns the number of objects added.
+    template <class U>
+    size_t insert(const std::vector<Ptr<U>>& objects)
+    {
+        reserve(size() + objects.size());
+        size_t added = 0;
+        for (size_t i = 0; i < objects.size(); ++i)
+        {
+            if (insert(Ptr<T>(objects[i])))
+                ++added;
+        }
+        return added;
+    }
+
+    /// Removes an object from the set.
+    /// Returns true if the object was in the set.
+    bool remove(const Ptr<T>& object)
+    {
+        typename Index::iterator found = m_index.find(object.get());
+        if (found == m_index.end())
+            return false;
+        m_items[found->second] = Ptr<T>();
+        m_index.erase(found);
+        if (++m_removed * 2 > m_items.size())
+            compact();
+        return true;
+    }
+
+    /// Removes all of the objects from the set.
+    void clear()
+    {
+        m_items.clear();
+        m_index.clear();
+        m_removed = 0;
+    }
+
+    /// Adds the objects of another set that aren't already in this set, keeping their order.
+    /// Returns this set.
+    ObjectSet& unite(const ObjectSet& other)
+    {
+        reserve(size() + other.size());
+        for (const_iterator it = other.begin(); it != other.end(); ++it)
+            insert(*it);
+        return *this;
+    }
+
+    /// Removes the objects that are not also in another set.
+    /// Returns this set.
+    ObjectSet& intersect(const ObjectSet& other)
+    {
+        if (size() != 0)
+            *this = *this & other;
+        return *this;
+    }
+
+    /// Removes the objects that are in another set.
+    /// Returns this set.
+    ObjectSet& subtract(const ObjectSet& other)
+    {
+        if (&other == this)
+        {
+            clear();
+            return *this;
+        }
+        for (const_iterator it = other.begin(); it != other.end(); ++it)
+            remove(*it);
+        return *this;
+    }
+
+    /// Returns the objects of the set in insertion order.
+    std::vector<Ptr<T>> asArray() const
+    {
+        std::vector<Ptr<T>> res;
+        res.reserve(size());
+        for (const_iterator it = begin(); it != end(); ++it)
+            res.push_back(*it);
+        return res;
+    }
+
+    /// Creates an ObjectCollection with the objects of the set in insertion order, passing all of
+    /// the objects to the new collection in a single call.
+    /// Returns the new collection or null in the case of failure.
+    Ptr<ObjectCollection> toObjectCollection() const
+    {
+        return ObjectCollection::create(begin(), end());
+    }
+
+    const_iterator begin() const { return const_iterator(&m_items, 0); }
+    const_iterator end() const { return const_iterator(&m_items, m_items.size()); }
+
+private:
+    typedef std::unordered_map<const T*, size_t, std::hash<const T*>> Index;
+
+    // Drops the slots of removed objects once they make up half of the storage, keeping the
+    // insertion order of the remaining objects.
+    void compact()
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < m_items.size(); ++i)
+        {
+            if (!m_items[i])
+                continue;
+            if (count != i)
+            {
+                m_items[count] = m_items[i];
+                m_index[m_items[count].get()] = count;
+            }
+            ++count;
+        }
+        m_items.resize(count);
+        m_removed = 0;
+    }
+
+    std::vector<Ptr<T>> m_items;
+    Index m_index;
+    size_t m_removed;
+};
+
+/// Returns the objects that are in either set, those of a first followed by those only in b.
+template <class T>
+inline ObjectSet<T> operator|(const ObjectSet<T>& a, const ObjectSet<T>& b)
+{
+    ObjectSet<T> res(a);
+    return res.unite(b);
+}
+
+/// Returns the objects of a that are also in b.
+template <class T>
+inline ObjectSet<T> operator&(const ObjectSet<T>& a, const ObjectSet<T>& b)
+{
+    ObjectSet<T> res;
+    res.reserve(a.size() < b.size() ? a.size() : b.size());
+    for (typename ObjectSet<T>::const_iterator it = a.begin(); it != a.end(); ++it)
+    {
+        if (b.contains(*it))
+            res.insert(*it);
+    }
+    return res;
+}
+
+/// Returns the objects of a that are not in b.
+template <class T>
+inline ObjectSet<T> operator-(const ObjectSet<T>& a, const ObjectSet<T>& b)
+{
+    ObjectSet<T> res;
+    for (typename ObjectSet<T>::const_iterator it = a.begin(); it != a.end(); ++it)
+    {
+        if (!b.contains(*it))
+            res.insert(*it);
+    }
+    return res;
+}
+
+}// namespace core
+}// namespace adsk
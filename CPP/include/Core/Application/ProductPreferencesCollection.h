@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -50,6 +51,10 @@ public:
     /// Returns the number of ProductPreference objects.
     size_t count() const;
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<ProductPreferences>> asArray() const;
+
     typedef ProductPreferences iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -64,6 +69,7 @@ private:
     virtual ProductPreferences* item_raw(size_t index) const = 0;
     virtual ProductPreferences* itemByName_raw(const char* name) const = 0;
     virtual size_t count_raw() const = 0;
+    virtual ProductPreferences** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -86,9 +92,23 @@ inline size_t ProductPreferencesCollection::count() const
     return res;
 }
 
+inline std::vector<Ptr<ProductPreferences>> ProductPreferencesCollection::asArray() const
+{
+    std::vector<Ptr<ProductPreferences>> res;
+    size_t s;
+
+    ProductPreferences** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void ProductPreferencesCollection::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -53,6 +54,10 @@ public:
     /// Returns the number of products within the collection.
     size_t count() const;
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Product>> asArray() const;
+
     typedef Product iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -67,6 +72,7 @@ private:
     virtual Product* item_raw(size_t index) const = 0;
     virtual Product* itemByProductType_raw(const char* productType) const = 0;
     virtual size_t count_raw() const = 0;
+    virtual Product** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -89,9 +95,23 @@ inline size_t Products::count() const
     return res;
 }
 
+inline std::vector<Ptr<Product>> Products::asArray() const
+{
+    std::vector<Ptr<Product>> res;
+    size_t s;
+
+    Product** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void Products::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
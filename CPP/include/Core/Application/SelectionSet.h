@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
 #include <vector>
 
@@ -113,12 +114,11 @@ inline std::vector<Ptr<Base>> SelectionSet::entities() const
 
 inline bool SelectionSet::entities(const std::vector<Ptr<Base>>& value)
 {
-    Base** value_ = new Base*[value.size()];
+    ScratchArray<Base*> value_(value.size());
     for(size_t i=0; i<value.size(); ++i)
         value_[i] = value[i].get();
 
     bool res = entities_raw(value_, value.size());
-    delete[] value_;
     return res;
 }
 
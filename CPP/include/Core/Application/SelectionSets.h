@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
 #include <vector>
 
@@ -67,6 +68,10 @@ public:
     /// can fail in the case where no entities are provided or if any of the provided entities are not selectable.
     Ptr<SelectionSet> add(const std::vector<Ptr<Base>>& entities, const std::string& name = "");
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<SelectionSet>> asArray() const;
+
     typedef SelectionSet iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -82,6 +87,7 @@ private:
     virtual SelectionSet* item_raw(size_t index) = 0;
     virtual SelectionSet* itemByName_raw(const char* name) = 0;
     virtual SelectionSet* add_raw(Base** entities, size_t entities_size, const char* name) = 0;
+    virtual SelectionSet** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -106,18 +112,31 @@ inline Ptr<SelectionSet> SelectionSets::itemByName(const std::string& name)
 
 inline Ptr<SelectionSet> SelectionSets::add(const std::vector<Ptr<Base>>& entities, const std::string& name)
 {
-    Base** entities_ = new Base*[entities.size()];
+    ScratchArray<Base*> entities_(entities.size());
     for(size_t i=0; i<entities.size(); ++i)
         entities_[i] = entities[i].get();
 
     Ptr<SelectionSet> res = add_raw(entities_, entities.size(), name.c_str());
-    delete[] entities_;
+    return res;
+}
+
+inline std::vector<Ptr<SelectionSet>> SelectionSets::asArray() const
+{
+    std::vector<Ptr<SelectionSet>> res;
+    size_t s;
+
+    SelectionSet** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
     return res;
 }
 
 template <class OutputIterator> inline void SelectionSets::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
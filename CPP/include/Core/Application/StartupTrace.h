@@ -0,0 +1,211 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../Base.h"
+#include "../CoreTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../OSMacros.h"
+
+#ifdef XINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CORE_STARTUPTRACE_CPP__
+# define ADSK_CORE_STARTUPTRACE_API XI_EXPORT
+# else
+# define ADSK_CORE_STARTUPTRACE_API
+# endif
+#else
+# define ADSK_CORE_STARTUPTRACE_API XI_IMPORT
+#endif
+
+namespace adsk { namespace core {
+    class StartupTraceEntry;
+}}
+
+namespace adsk { namespace core {
+
+/// Records where the time goes while Fusion starts, for the work done by and for add-ins. The run
+/// function of each add-in loaded at startup is timed, along with the work done inside it to create
+/// command definitions, load their resource folders, and create toolbar items and palettes. Work that
+/// has been deferred by CommandDefinitions.isLazyLoading is recorded when it's eventually done, so the
+/// trace also shows how much of it was moved out of startup.
+///
+/// Entries are recorded from the time Fusion starts until the startupCompleted event has fired and for
+/// add-ins started afterwards from the Scripts and Add-Ins dialog. Use Application.startupTrace to get
+/// this object.
+class StartupTrace : public Base {
+public:
+
+    /// Returns the time, in seconds, from when Fusion started until it completed its startup. Returns 0
+    /// if the startup isn't complete. See Application.isStartupComplete.
+    double startupTime() const;
+
+    /// Returns all of the entries in the trace in the order they started. An entry for work done inside
+    /// the run function of an add-in is returned after the entry of the run function, and its time is
+    /// included in the time of the run function.
+    std::vector<Ptr<StartupTraceEntry>> entries() const;
+
+    /// Returns the total time, in seconds, spent in the run function of an add-in, including the work
+    /// it did that is also recorded in other entries.
+    /// addInName : The name of the add-in.
+    /// Returns the time, or 0 if the add-in hasn't been run.
+    double addInTime(const std::string& addInName) const;
+
+    /// Writes the trace to a file in the Trace Event Format, which can be opened by trace viewers such
+    /// as the one in Chromium based browsers or Perfetto. This is the same format that
+    /// EventStatistics.exportTrace writes.
+    /// filename : The full path of the JSON file to write. An existing file is overwritten.
+    /// Returns true if the file was written successfully.
+    bool exportTrace(const std::string& filename) const;
+
+    ADSK_CORE_STARTUPTRACE_API static const char* classType();
+    ADSK_CORE_STARTUPTRACE_API const char* objectType() const override;
+    ADSK_CORE_STARTUPTRACE_API void* queryInterface(const char* id) const override;
+    ADSK_CORE_STARTUPTRACE_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual double startupTime_raw() const = 0;
+    virtual StartupTraceEntry** entries_raw(size_t& return_size) const = 0;
+    virtual double addInTime_raw(const char* addInName) const = 0;
+    virtual bool exportTrace_raw(const char* filename) const = 0;
+};
+
+/// A single piece of work recorded in the StartupTrace.
+class StartupTraceEntry : public Base {
+public:
+
+    /// Returns the kind of work the entry records.
+    StartupTraceEntryTypes entryType() const;
+
+    /// Returns the name of the add-in the work was done for.
+    std::string addInName() const;
+
+    /// Returns the id of the item the work was done for, such as the id of the command definition,
+    /// toolbar panel or palette. This is an empty string for the run function of an add-in.
+    std::string itemId() const;
+
+    /// Returns the time, in seconds since Fusion started, at which the work started.
+    double startTime() const;
+
+    /// Returns the time, in seconds, the work took.
+    double duration() const;
+
+    /// Returns true if the work was deferred by CommandDefinitions.isLazyLoading and was done after
+    /// the startup of Fusion had completed, when the item was first displayed or used.
+    bool isDeferred() const;
+
+    ADSK_CORE_STARTUPTRACE_API static const char* classType();
+    ADSK_CORE_STARTUPTRACE_API const char* objectType() const override;
+    ADSK_CORE_STARTUPTRACE_API void* queryInterface(const char* id) const override;
+    ADSK_CORE_STARTUPTRACE_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual StartupTraceEntryTypes entryType_raw() const = 0;
+    virtual char* addInName_raw() const = 0;
+    virtual char* itemId_raw() const = 0;
+    virtual double startTime_raw() const = 0;
+    virtual double duration_raw() const = 0;
+    virtual bool isDeferred_raw() const = 0;
+};
+
+// Inline wrappers
+
+inline double StartupTrace::startupTime() const
+{
+    double res = startupTime_raw();
+    return res;
+}
+
+inline std::vector<Ptr<StartupTraceEntry>> StartupTrace::entries() const
+{
+    std::vector<Ptr<StartupTraceEntry>> res;
+    size_t s;
+
+    StartupTraceEntry** p= entries_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline double StartupTrace::addInTime(const std::string& addInName) const
+{
+    double res = addInTime_raw(addInName.c_str());
+    return res;
+}
+
+inline bool StartupTrace::exportTrace(const std::string& filename) const
+{
+    bool res = exportTrace_raw(filename.c_str());
+    return res;
+}
+
+inline StartupTraceEntryTypes StartupTraceEntry::entryType() const
+{
+    StartupTraceEntryTypes res = entryType_raw();
+    return res;
+}
+
+inline std::string StartupTraceEntry::addInName() const
+{
+    std::string res;
+
+    char* p= addInName_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::string StartupTraceEntry::itemId() const
+{
+    std::string res;
+
+    char* p= itemId_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline double StartupTraceEntry::startTime() const
+{
+    double res = startTime_raw();
+    return res;
+}
+
+inline double StartupTraceEntry::duration() const
+{
+    double res = duration_raw();
+    return res;
+}
+
+inline bool StartupTraceEntry::isDeferred() const
+{
+    bool res = isDeferred_raw();
+    return res;
+}
+}// namespace core
+}// namespace adsk
+
+#undef ADSK_CORE_STARTUPTRACE_API
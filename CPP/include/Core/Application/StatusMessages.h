@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -100,6 +101,10 @@ public:
     /// Returns true if the warning message was successfully added.
     Ptr<StatusMessage> addWarning(const std::string& messageId = "", const std::string& message = "");
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<StatusMessage>> asArray() const;
+
     typedef StatusMessage iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -115,6 +120,7 @@ private:
     virtual StatusMessage* item_raw(size_t index) const = 0;
     virtual StatusMessage* addError_raw(const char* messageId, const char* message) = 0;
     virtual StatusMessage* addWarning_raw(const char* messageId, const char* message) = 0;
+    virtual StatusMessage** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -143,9 +149,23 @@ inline Ptr<StatusMessage> StatusMessages::addWarning(const std::string& messageI
     return res;
 }
 
+inline std::vector<Ptr<StatusMessage>> StatusMessages::asArray() const
+{
+    std::vector<Ptr<StatusMessage>> res;
+    size_t s;
+
+    StatusMessage** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void StatusMessages::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
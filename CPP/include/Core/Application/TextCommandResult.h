@@ -0,0 +1,137 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../Base.h"
+#include "../CoreTypeDefs.h"
+#include "EventHandler.h"
+#include <string>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../OSMacros.h"
+
+#ifdef XINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CORE_TEXTCOMMANDRESULT_CPP__
+# define ADSK_CORE_TEXTCOMMANDRESULT_API XI_EXPORT
+# else
+# define ADSK_CORE_TEXTCOMMANDRESULT_API
+# endif
+#else
+# define ADSK_CORE_TEXTCOMMANDRESULT_API XI_IMPORT
+#endif
+
+namespace adsk { namespace core {
+
+/// The result of one of the commands run by Application.executeTextCommands.
+class TextCommandResult : public Base {
+public:
+
+    /// Returns the position of the command in the list of commands that was passed in.
+    size_t index() const;
+
+    /// Returns the text command that was executed.
+    std::string command() const;
+
+    /// Returns true if the command was executed successfully.
+    bool isSuccess() const;
+
+    /// Returns the output of the command. This is the same string Application.executeTextCommand
+    /// returns for the command.
+    std::string result() const;
+
+    /// Returns the description of the error when the command failed, which includes failing to
+    /// parse the command. Returns an empty string when the command succeeded.
+    std::string errorDescription() const;
+
+    ADSK_CORE_TEXTCOMMANDRESULT_API static const char* classType();
+    ADSK_CORE_TEXTCOMMANDRESULT_API const char* objectType() const override;
+    ADSK_CORE_TEXTCOMMANDRESULT_API void* queryInterface(const char* id) const override;
+    ADSK_CORE_TEXTCOMMANDRESULT_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual size_t index_raw() const = 0;
+    virtual char* command_raw() const = 0;
+    virtual bool isSuccess_raw() const = 0;
+    virtual char* result_raw() const = 0;
+    virtual char* errorDescription_raw() const = 0;
+};
+
+/// The TextCommandResultHandler is a client implemented class that is passed to
+/// Application.executeTextCommands to receive the result of each command as soon as it has run.
+class TextCommandResultHandler : public EventHandler {
+public:
+
+    /// The function called by Fusion 360 after each command of the batch has run. It is called on the
+    /// thread that called Application.executeTextCommands, before the next command runs.
+    /// result : Returns the result of the command that has just run. The object isn't kept by Fusion
+    /// once the call returns, so the memory held by the output of each command is released as the batch
+    /// goes on unless the handler keeps a reference to it.
+    ADSK_CORE_TEXTCOMMANDRESULT_API virtual void notify(const Ptr<TextCommandResult>& result) = 0;
+};
+
+// Inline wrappers
+
+inline size_t TextCommandResult::index() const
+{
+    size_t res = index_raw();
+    return res;
+}
+
+inline std::string TextCommandResult::command() const
+{
+    std::string res;
+
+    char* p= command_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool TextCommandResult::isSuccess() const
+{
+    bool res = isSuccess_raw();
+    return res;
+}
+
+inline std::string TextCommandResult::result() const
+{
+    std::string res;
+
+    char* p= result_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::string TextCommandResult::errorDescription() const
+{
+    std::string res;
+
+    char* p= errorDescription_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+}// namespace core
+}// namespace adsk
+
+#undef ADSK_CORE_TEXTCOMMANDRESULT_API
@@ -0,0 +1,140 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../Base.h"
+#include "../CoreTypeDefs.h"
+#include <string>
+#include <vector>
+
+// THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
+// THIS HEADER FILE WILL BE GENERATED FROM NIDL.
+#include "../OSMacros.h"
+
+#ifdef XINTERFACE_EXPORTS
+# ifdef __COMPILING_ADSK_CORE_UNITCONVERSION_CPP__
+# define ADSK_CORE_UNITCONVERSION_API XI_EXPORT
+# else
+# define ADSK_CORE_UNITCONVERSION_API
+# endif
+#else
+# define ADSK_CORE_UNITCONVERSION_API XI_IMPORT
+#endif
+
+namespace adsk { namespace core {
+
+/// A conversion between two compatible units whose units have been parsed and whose factors have been
+/// worked out once, so it can be applied to any number of values without parsing the units again. Every
+/// conversion between units is linear, so a value is converted as value * scale + offset. The offset is
+/// 0 for all units except temperatures. Clients that convert values one at a time in their own loops can
+/// read the scale and offset and do the arithmetic themselves, without calling into Fusion for each value.
+///
+/// Use UnitsManager.createUnitConversion to create a UnitConversion. The factors are fixed when it is
+/// created, so a conversion from "DefaultDistance" keeps the default length units of that moment.
+class UnitConversion : public Base {
+public:
+
+    /// Returns the units the values are converted from.
+    std::string inputUnits() const;
+
+    /// Returns the units the values are converted to.
+    std::string outputUnits() const;
+
+    /// Returns the factor the values are multiplied by.
+    double scale() const;
+
+    /// Returns the amount added to the values after they're multiplied by the scale.
+    double offset() const;
+
+    /// Converts an array of values.
+    /// values : The array of values to convert, in the input units.
+    /// count : The number of values in the array.
+    /// results : The array that receives the converted values, in the output units. It must hold at least count
+    /// values and can be the same array as values to convert the values in place.
+    /// Returns true if successful.
+    bool convert(const double* values, size_t count, double* results) const;
+
+    /// Converts a list of values.
+    /// values : The values to convert, in the input units.
+    /// Returns the converted values, in the output units.
+    std::vector<double> convert(const std::vector<double>& values) const;
+
+    ADSK_CORE_UNITCONVERSION_API static const char* classType();
+    ADSK_CORE_UNITCONVERSION_API const char* objectType() const override;
+    ADSK_CORE_UNITCONVERSION_API void* queryInterface(const char* id) const override;
+    ADSK_CORE_UNITCONVERSION_API static const char* interfaceId() { return classType(); }
+
+private:
+
+    // Raw interface
+    virtual char* inputUnits_raw() const = 0;
+    virtual char* outputUnits_raw() const = 0;
+    virtual double scale_raw() const = 0;
+    virtual double offset_raw() const = 0;
+    virtual bool convert_raw(const double* values, size_t count, double* results) const = 0;
+};
+
+// Inline wrappers
+
+inline std::string UnitConversion::inputUnits() const
+{
+    std::string res;
+
+    char* p= inputUnits_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline std::string UnitConversion::outputUnits() const
+{
+    std::string res;
+
+    char* p= outputUnits_raw();
+    if (p)
+    {
+        res = p;
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline double UnitConversion::scale() const
+{
+    double res = scale_raw();
+    return res;
+}
+
+inline double UnitConversion::offset() const
+{
+    double res = offset_raw();
+    return res;
+}
+
+inline bool UnitConversion::convert(const double* values, size_t count, double* results) const
+{
+    bool res = convert_raw(values, count, results);
+    return res;
+}
+
+inline std::vector<double> UnitConversion::convert(const std::vector<double>& values) const
+{
+    std::vector<double> res(values.size());
+    if(!convert_raw(values.data(), values.size(), res.data()))
+        res.clear();
+    return res;
+}
+}// namespace core
+}// namespace adsk
+
+#undef ADSK_CORE_UNITCONVERSION_API
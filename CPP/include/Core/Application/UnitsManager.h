@@ -11,7 +11,9 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -28,7 +30,9 @@
 #endif
 
 namespace adsk { namespace core {
+    class CompiledExpression;
     class Product;
+    class UnitConversion;
 }}
 
 namespace adsk { namespace core {
@@ -73,6 +77,33 @@ public:
     /// Returns -1 AND GetLastError returns ExpressionError in the event of an error.
     double convert(double valueInInputUnits, const std::string& inputUnits, const std::string& outputUnits) const;
 
+    /// Converts an array of values from one unit to another in a single call. The units are parsed once for
+    /// the whole array, which makes this much faster than calling convert for each value.
+    /// values : The array of values to convert.
+    /// count : The number of values in the array.
+    /// inputUnits : The units of the values to convert
+    /// outputUnits : The units to convert the values to
+    /// results : The array that receives the converted values. It must hold at least count values and can be the
+    /// same array as values to convert the values in place.
+    /// Returns false AND GetLastError returns ExpressionError if the units are incorrectly specified or aren't compatible.
+    bool convert(const double* values, size_t count, const std::string& inputUnits, const std::string& outputUnits, double* results) const;
+
+    /// Converts a list of values from one unit to another in a single call.
+    /// values : The values to convert.
+    /// inputUnits : The units of the values to convert
+    /// outputUnits : The units to convert the values to
+    /// Returns the converted values. Returns an empty array AND GetLastError returns ExpressionError if the units are
+    /// incorrectly specified or aren't compatible.
+    std::vector<double> convert(const std::vector<double>& values, const std::string& inputUnits, const std::string& outputUnits) const;
+
+    /// Creates an object that converts values between two units using factors that are worked out once. Use this when
+    /// the same conversion is applied to values that become available at different times.
+    /// inputUnits : The units of the values to convert
+    /// outputUnits : The units to convert the values to
+    /// Returns the new UnitConversion or null AND GetLastError returns ExpressionError if the units are incorrectly
+    /// specified or aren't compatible.
+    Ptr<UnitConversion> createUnitConversion(const std::string& inputUnits, const std::string& outputUnits) const;
+
     /// Formats the internal value as a string. The output string is formatted using the current
     /// unit settings in preferences. The preferences control the number of decimal places, whether
     /// units are abbreviated and several other things.
@@ -86,6 +117,62 @@ public:
     /// Returns an empty string if the units are incorrectly specified.
     std::string formatInternalValue(double internalValue, const std::string& displayUnits = "DefaultDistance", bool showUnits = true) const;
 
+    /// Formats an internal value the way formatInternalValue does, returning the result in a string supplied by the
+    /// caller. When the same string is passed to repeated calls, its storage is reused and no memory is allocated once
+    /// it is large enough, which makes this the faster choice when formatting many values.
+    /// internalValue : The internal value to format.
+    /// displayUnits : The units to display the value in. Use "DefaultDistance" for the default length specified in the preferences.
+    /// showUnits : Specify false to exclude units from the format.
+    /// result : The output formatted value.
+    /// Returns false and clears result if the units are incorrectly specified.
+    bool formatInternalValue(double internalValue, const std::string& displayUnits, bool showUnits, std::string& result) const;
+
+    /// Formats an internal value the way formatInternalValue does, writing the result as a null terminated string into
+    /// a buffer supplied by the caller.
+    /// internalValue : The internal value to format.
+    /// displayUnits : The units to display the value in. Use "DefaultDistance" for the default length specified in the preferences.
+    /// showUnits : Specify false to exclude units from the format.
+    /// buffer : The output buffer. Nothing is written if the buffer is too small.
+    /// capacity : The number of characters the buffer can hold, including the terminating null.
+    /// length : The output length of the formatted value, not including the terminating null. This is returned even when the
+    /// buffer is too small, so the call can be repeated with a buffer of at least length + 1 characters.
+    /// Returns false if the units are incorrectly specified. Returns true if the value was successfully formatted or the
+    /// buffer was too small. Compare length with capacity to know if the value was written.
+    bool formatInternalValue(double internalValue, const std::string& displayUnits, bool showUnits, char* buffer, size_t capacity, size_t& length) const;
+
+    /// Formats an array of internal values the way formatInternalValue does, writing all of them into a single string
+    /// supplied by the caller. The formatted values follow each other in the string, each ending with a null character,
+    /// so the string can be written out as is or each value can be used as a null terminated string. The preferences
+    /// and units are read once for the whole array and no memory is allocated for each value.
+    /// values : The array of internal values to format.
+    /// count : The number of values in the array.
+    /// displayUnits : The units to display the values in. Use "DefaultDistance" for the default length specified in the preferences.
+    /// showUnits : Specify false to exclude units from the format.
+    /// result : The output string holding all of the formatted values.
+    /// offsets : The output positions in result where each formatted value starts. There is one more offset than there
+    /// are values and the last is the length of result, so the length of the value at index i is
+    /// offsets[i + 1] - offsets[i] - 1.
+    /// Returns false and clears result and offsets if the units are incorrectly specified.
+    bool formatInternalValues(const double* values, size_t count, const std::string& displayUnits, bool showUnits, std::string& result, std::vector<size_t>& offsets) const;
+
+    /// Formats an array of internal values the way formatInternalValue does, writing all of them into a buffer
+    /// supplied by the caller. The formatted values follow each other in the buffer, each ending with a null character.
+    /// values : The array of internal values to format.
+    /// count : The number of values in the array.
+    /// displayUnits : The units to display the values in. Use "DefaultDistance" for the default length specified in the preferences.
+    /// showUnits : Specify false to exclude units from the format.
+    /// buffer : The output buffer. Nothing is written if the buffer is too small.
+    /// capacity : The number of characters the buffer can hold.
+    /// length : The output number of characters used by all of the formatted values, including the null character that
+    /// ends each of them. This is returned even when the buffer is too small, so the call can be repeated with a buffer
+    /// of at least length characters.
+    /// offsets : An array supplied by the caller that receives the position in the buffer where each formatted value
+    /// starts. It must hold count + 1 positions, the last of which is set to length. The offsets are returned even
+    /// when the buffer is too small.
+    /// Returns false if the units are incorrectly specified. Returns true if the values were successfully formatted or
+    /// the buffer was too small. Compare length with capacity to know if the values were written.
+    bool formatInternalValues(const double* values, size_t count, const std::string& displayUnits, bool showUnits, char* buffer, size_t capacity, size_t& length, size_t* offsets) const;
+
     /// Formats the unit according to the user preferences
     /// "centimeter" -> "cm"
     /// "inch" -> "in"
@@ -115,6 +202,19 @@ public:
     /// length unit, the distanceDisplayUnits of the FusionUnitsManager object returns an enum value.
     std::string defaultLengthUnits() const;
 
+    /// Parses an expression once so it can be evaluated many times with different values for its variables,
+    /// which is much faster than calling evaluateExpression for each set of values. The unit conversions are
+    /// resolved when the expression is compiled. See CompiledExpression for more information.
+    /// expression : The expression to compile. It can refer to the variables by name, for example "width * 2 + 5 mm".
+    /// variableNames : The names of the variables the expression can use. The order of the names is the order
+    /// their values are passed to CompiledExpression.evaluate.
+    /// variableUnits : The units of each variable, in the same order as variableNames. These determine how each
+    /// variable combines with the rest of the expression, in the same way as the units of a parameter do.
+    /// units : The units of the result. If not supplied the units will default to the default length specified in the preferences.
+    /// Returns the compiled expression or null AND GetLastError will return ExpressionError if the expression isn't
+    /// valid, which makes this a replacement for isValidExpression too.
+    Ptr<CompiledExpression> compileExpression(const std::string& expression, const std::vector<std::string>& variableNames, const std::vector<std::string>& variableUnits, const std::string& units = "DefaultDistance") const;
+
     ADSK_CORE_UNITSMANAGER_API static const char* classType();
     ADSK_CORE_UNITSMANAGER_API const char* objectType() const override;
     ADSK_CORE_UNITSMANAGER_API void* queryInterface(const char* id) const override;
@@ -132,11 +232,11 @@ private:
     virtual char* standardizeExpression_raw(const char* expression, const char* units) const = 0;
     virtual char* internalUnits_raw() const = 0;
     virtual char* defaultLengthUnits_raw() const = 0;
-    virtual void placeholderUnitsManager0() {}
-    virtual void placeholderUnitsManager1() {}
-    virtual void placeholderUnitsManager2() {}
-    virtual void placeholderUnitsManager3() {}
-    virtual void placeholderUnitsManager4() {}
+    virtual bool formatInternalValueToBuffer_raw(double internalValue, const char* displayUnits, bool showUnits, char* buffer, size_t capacity, size_t& length) const = 0;
+    virtual CompiledExpression* compileExpression_raw(const char* expression, const char** variableNames, size_t variableNames_size, const char** variableUnits, size_t variableUnits_size, const char* units) const = 0;
+    virtual bool convertArray_raw(const double* values, size_t count, const char* inputUnits, const char* outputUnits, double* results) const = 0;
+    virtual UnitConversion* createUnitConversion_raw(const char* inputUnits, const char* outputUnits) const = 0;
+    virtual bool formatInternalValues_raw(const double* values, size_t count, const char* displayUnits, bool showUnits, char* buffer, size_t capacity, size_t& length, size_t* offsets) const = 0;
     virtual void placeholderUnitsManager5() {}
     virtual void placeholderUnitsManager6() {}
     virtual void placeholderUnitsManager7() {}
@@ -183,6 +283,26 @@ inline double UnitsManager::convert(double valueInInputUnits, const std::string&
     return res;
 }
 
+inline bool UnitsManager::convert(const double* values, size_t count, const std::string& inputUnits, const std::string& outputUnits, double* results) const
+{
+    bool res = convertArray_raw(values, count, inputUnits.c_str(), outputUnits.c_str(), results);
+    return res;
+}
+
+inline std::vector<double> UnitsManager::convert(const std::vector<double>& values, const std::string& inputUnits, const std::string& outputUnits) const
+{
+    std::vector<double> res(values.size());
+    if(!convertArray_raw(values.data(), values.size(), inputUnits.c_str(), outputUnits.c_str(), res.data()))
+        res.clear();
+    return res;
+}
+
+inline Ptr<UnitConversion> UnitsManager::createUnitConversion(const std::string& inputUnits, const std::string& outputUnits) const
+{
+    Ptr<UnitConversion> res = createUnitConversion_raw(inputUnits.c_str(), outputUnits.c_str());
+    return res;
+}
+
 inline std::string UnitsManager::formatInternalValue(double internalValue, const std::string& displayUnits, bool showUnits) const
 {
     std::string res;
@@ -196,6 +316,49 @@ inline std::string UnitsManager::formatInternalValue(double internalValue, const
     return res;
 }
 
+inline bool UnitsManager::formatInternalValue(double internalValue, const std::string& displayUnits, bool showUnits, std::string& result) const
+{
+    size_t length = 0;
+    result.resize(result.capacity());
+    bool res = formatInternalValueToBuffer_raw(internalValue, displayUnits.c_str(), showUnits, &result[0], result.size() + 1, length);
+    if(res && length > result.size())
+    {
+        result.resize(length);
+        res = formatInternalValueToBuffer_raw(internalValue, displayUnits.c_str(), showUnits, &result[0], result.size() + 1, length);
+    }
+    result.resize(res ? length : 0);
+    return res;
+}
+
+inline bool UnitsManager::formatInternalValue(double internalValue, const std::string& displayUnits, bool showUnits, char* buffer, size_t capacity, size_t& length) const
+{
+    bool res = formatInternalValueToBuffer_raw(internalValue, displayUnits.c_str(), showUnits, buffer, capacity, length);
+    return res;
+}
+
+inline bool UnitsManager::formatInternalValues(const double* values, size_t count, const std::string& displayUnits, bool showUnits, std::string& result, std::vector<size_t>& offsets) const
+{
+    size_t length = 0;
+    offsets.resize(count + 1);
+    result.resize(result.capacity());
+    bool res = formatInternalValues_raw(values, count, displayUnits.c_str(), showUnits, &result[0], result.size(), length, offsets.data());
+    if(res && length > result.size())
+    {
+        result.resize(length);
+        res = formatInternalValues_raw(values, count, displayUnits.c_str(), showUnits, &result[0], result.size(), length, offsets.data());
+    }
+    result.resize(res ? length : 0);
+    if(!res)
+        offsets.clear();
+    return res;
+}
+
+inline bool UnitsManager::formatInternalValues(const double* values, size_t count, const std::string& displayUnits, bool showUnits, char* buffer, size_t capacity, size_t& length, size_t* offsets) const
+{
+    bool res = formatInternalValues_raw(values, count, displayUnits.c_str(), showUnits, buffer, capacity, length, offsets);
+    return res;
+}
+
 inline std::string UnitsManager::formatUnits(const std::string& units) const
 {
     std::string res;
@@ -247,6 +410,24 @@ inline std::string UnitsManager::defaultLengthUnits() const
     }
     return res;
 }
+
+inline Ptr<CompiledExpression> UnitsManager::compileExpression(const std::string& expression, const std::vector<std::string>& variableNames, const std::vector<std::string>& variableUnits, const std::string& units) const
+{
+    ScratchArray<const char*> variableNames_(variableNames.size());
+    for(size_t i = 0; i < variableNames.size(); ++i)
+    {
+        variableNames_[i] = variableNames[i].c_str();
+    }
+
+    ScratchArray<const char*> variableUnits_(variableUnits.size());
+    for(size_t i = 0; i < variableUnits.size(); ++i)
+    {
+        variableUnits_[i] = variableUnits[i].c_str();
+    }
+
+    Ptr<CompiledExpression> res = compileExpression_raw(expression.c_str(), variableNames_, variableNames.size(), variableUnits_, variableUnits.size(), units.c_str());
+    return res;
+}
 }// namespace core
 }// namespace adsk
 
@@ -0,0 +1,144 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "Base.h"
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+// THIS CLASS IS USED BY AN API CLIENT
+
+namespace adsk { namespace core {
+
+/// A random access view of an API collection, such as Workspaces, CommandInputs, Selections,
+/// DataFiles, Attributes, Properties or ObjectCollection, that can be used with range-based for
+/// loops and the std algorithms.
+///
+/// The number of items is read once when the view is created, so iterating does not query the
+/// count of the collection again. Each item is retrieved from the collection when it is accessed,
+/// which is the fastest way to visit every item once. A view that is iterated more than once can
+/// call prefetch, which retrieves all of the items with a single call to the asArray method of the
+/// collection, so that later accesses are served from the view.
+///
+/// The view does not track changes to the collection. Create a new view after items have been
+/// added to or removed from the collection.
+///
+///     for (Ptr<Attribute> attribute : view(attributes))
+///         ...
+template <class Collection>
+class CollectionView {
+public:
+
+    typedef typename Collection::iterable_type item_type;
+    typedef Ptr<item_type> value_type;
+    typedef size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    /// Random access iterator over the view. Dereferencing returns the item by value.
+    class const_iterator {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename CollectionView::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef value_type reference;
+
+        const_iterator() : m_view(nullptr), m_index(0) {}
+        const_iterator(const CollectionView* view, size_t index) : m_view(view), m_index(index) {}
+
+        value_type operator*() const { return (*m_view)[m_index]; }
+        value_type operator[](difference_type offset) const { return (*m_view)[m_index + offset]; }
+
+        const_iterator& operator++() { ++m_index; return *this; }
+        const_iterator operator++(int) { const_iterator tmp(*this); ++m_index; return tmp; }
+        const_iterator& operator--() { --m_index; return *this; }
+        const_iterator operator--(int) { const_iterator tmp(*this); --m_index; return tmp; }
+        const_iterator& operator+=(difference_type offset) { m_index += offset; return *this; }
+        const_iterator& operator-=(difference_type offset) { m_index -= offset; return *this; }
+        const_iterator operator+(difference_type offset) const { return const_iterator(m_view, m_index + offset); }
+        const_iterator operator-(difference_type offset) const { return const_iterator(m_view, m_index - offset); }
+        friend const_iterator operator+(difference_type offset, const const_iterator& it) { return it + offset; }
+        difference_type operator-(const const_iterator& other) const { return static_cast<difference_type>(m_index) - static_cast<difference_type>(other.m_index); }
+
+        bool operator==(const const_iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const const_iterator& other) const { return m_index != other.m_index; }
+        bool operator<(const const_iterator& other) const { return m_index < other.m_index; }
+        bool operator>(const const_iterator& other) const { return m_index > other.m_index; }
+        bool operator<=(const const_iterator& other) const { return m_index <= other.m_index; }
+        bool operator>=(const const_iterator& other) const { return m_index >= other.m_index; }
+
+    private:
+        const CollectionView* m_view;
+        size_t m_index;
+    };
+    typedef const_iterator iterator;
+
+    /// Creates a view of a collection. The view holds a reference to the collection.
+    /// collection : The collection to view. A null collection results in an empty view.
+    explicit CollectionView(const Ptr<Collection>& collection)
+        : m_collection(collection), m_count(0), m_isPrefetched(false)
+    {
+        if (m_collection)
+            m_count = m_collection->count();
+    }
+
+    /// Retrieves all of the items of the collection with a single call. After this, accessing
+    /// items through the view no longer calls into the collection. This only pays off for a view
+    /// that is iterated more than once, because a single pass costs more with the copy of the items.
+    void prefetch()
+    {
+        if (!m_isPrefetched && m_collection)
+        {
+            m_items = m_collection->asArray();
+            m_count = m_items.size();
+            m_isPrefetched = true;
+        }
+    }
+
+    /// Indicates if the items have been retrieved by prefetch.
+    bool isPrefetched() const { return m_isPrefetched; }
+
+    /// Returns the number of items in the view.
+    size_t size() const { return m_count; }
+
+    /// Returns true if the view has no items.
+    bool empty() const { return m_count == 0; }
+
+    /// Returns the item at the specified index, which must be less than size.
+    value_type operator[](size_t index) const
+    {
+        return m_isPrefetched ? m_items[index] : m_collection->item(index);
+    }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_count); }
+
+    /// Returns the collection this is a view of.
+    const Ptr<Collection>& collection() const { return m_collection; }
+
+private:
+    Ptr<Collection> m_collection;
+    size_t m_count;
+    bool m_isPrefetched;
+    std::vector<value_type> m_items;
+};
+
+/// Creates a CollectionView of a collection.
+/// collection : The collection to view.
+/// Returns the new view.
+template <class Collection>
+inline CollectionView<Collection> view(const Ptr<Collection>& collection)
+{
+    return CollectionView<Collection>(collection);
+}
+
+}// namespace core
+}// namespace adsk
@@ -1,11 +1,16 @@
 #include <Core/Utils.h>
+#include <Core/CollectionView.h>
+#include <Core/ScratchArena.h>
 #include <Core/Application/Application.h>
 #include <Core/Application/ApplicationEvents.h>
+#include <Core/Application/AsyncLog.h>
 #include <Core/Application/Attribute.h>
 #include <Core/Application/Attributes.h>
+#include <Core/Application/BatchErrors.h>
 #include <Core/Application/Camera.h>
 #include <Core/Application/CameraEvents.h>
 #include <Core/Application/Color.h>
+#include <Core/Application/CompiledExpression.h>
 #include <Core/Application/CustomEvents.h>
 #include <Core/Application/DefaultUnitsPreferences.h>
 #include <Core/Application/DefaultUnitsPreferencesCollection.h>
@@ -17,6 +22,7 @@
 #include <Core/Application/DXF2DImportOptions.h>
 #include <Core/Application/EventHandler.h>
 #include <Core/Application/Events.h>
+#include <Core/Application/EventStatistics.h>
 #include <Core/Application/FusionArchiveImportOptions.h>
 #include <Core/Application/GeneralPreferences.h>
 #include <Core/Application/GraphicsPreferences.h>
@@ -25,12 +31,15 @@
 #include <Core/Application/IGESImportOptions.h>
 #include <Core/Application/ImportManager.h>
 #include <Core/Application/ImportOptions.h>
+#include <Core/Application/Job.h>
+#include <Core/Application/JobEvents.h>
 #include <Core/Application/MaterialPreferences.h>
 #include <Core/Application/MeasureManager.h>
 #include <Core/Application/MeasureResults.h>
 #include <Core/Application/NamedValues.h>
 #include <Core/Application/NetworkPreferences.h>
 #include <Core/Application/ObjectCollection.h>
+#include <Core/Application/ObjectSet.h>
 #include <Core/Application/Preferences.h>
 #include <Core/Application/Product.h>
 #include <Core/Application/ProductPreferences.h>
@@ -43,12 +52,15 @@
 #include <Core/Application/SelectionSet.h>
 #include <Core/Application/SelectionSets.h>
 #include <Core/Application/SMTImportOptions.h>
+#include <Core/Application/StartupTrace.h>
 #include <Core/Application/Status.h>
 #include <Core/Application/StatusMessage.h>
 #include <Core/Application/StatusMessages.h>
 #include <Core/Application/STEPImportOptions.h>
 #include <Core/Application/SVGImportOptions.h>
+#include <Core/Application/TextCommandResult.h>
 #include <Core/Application/UnitAndValuePreferences.h>
+#include <Core/Application/UnitConversion.h>
 #include <Core/Application/UnitsManager.h>
 #include <Core/Application/URL.h>
 #include <Core/Application/User.h>
@@ -67,6 +79,7 @@
 #include <Core/Dashboard/DataProject.h>
 #include <Core/Dashboard/DataProjects.h>
 #include <Core/Dashboard/PersonalUseLimits.h>
+#include <Core/Geometry/AnalyticSurfaceEvaluator.h>
 #include <Core/Geometry/Arc2D.h>
 #include <Core/Geometry/Arc3D.h>
 #include <Core/Geometry/BoundingBox2D.h>
@@ -252,6 +252,21 @@ enum HubTypes
     TeamHubType
 };
 
+/// The types of background jobs.
+enum JobTypes
+{
+    /// The upload of a document to the cloud, including any cloud side translations.
+    UploadJobType,
+    /// The download of a document or file from the cloud.
+    DownloadJobType,
+    /// A translation of a document to or from another format.
+    TranslationJobType,
+    /// A recompute of a document.
+    RecomputeJobType,
+    /// A job of any other type.
+    OtherJobType
+};
+
 /// Keyboard modifier values.
 enum KeyboardModifiers
 {
@@ -691,6 +706,21 @@ enum SelectionDisplayStyles
     SimpleDisplayStyle
 };
 
+/// The kinds of work recorded in the startup trace.
+enum StartupTraceEntryTypes
+{
+    /// The call of the run function of an add-in.
+    AddInRunStartupTraceEntryType,
+    /// The creation of a command definition, for example by CommandDefinitions.addButtonDefinition.
+    CommandDefinitionStartupTraceEntryType,
+    /// The loading of the icons from the resource folder of a command definition or control.
+    ResourceFolderStartupTraceEntryType,
+    /// The creation of a toolbar, toolbar tab, toolbar panel or toolbar control.
+    ToolbarStartupTraceEntryType,
+    /// The creation of a palette, including the loading of its HTML.
+    PaletteStartupTraceEntryType
+};
+
 /// The different types of status messages that can be used with the StatusCode object.
 enum StatusMessageTypes
 {
@@ -46,6 +46,21 @@ public:
     std::string name() const;
     bool name(const std::string& value);
 
+    /// Gets the displayed name of this item into a string supplied by the caller. When the same string is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// name : The output string.
+    /// Returns true if the value was successfully returned.
+    bool getName(std::string& name) const;
+
+    /// Gets the displayed name of this item, writing it as a null terminated string into a buffer supplied by the caller.
+    /// buffer : The output buffer. Nothing is written if the buffer is too small.
+    /// capacity : The number of characters the buffer can hold, including the terminating null.
+    /// length : The output length of the string, not including the terminating null. This is returned even when the
+    /// buffer is too small, so the call can be repeated with a buffer of at least length + 1 characters.
+    /// Returns true if the value was successfully returned or the buffer was too small. Compare length with
+    /// capacity to know if the value was written.
+    bool getName(char* buffer, size_t capacity, size_t& length) const;
+
     /// Gets and sets the description information associated with this item.
     std::string description() const;
 
@@ -60,6 +75,21 @@ public:
     /// look similar to this: "urn:adsk.wipprod:dm.lineage:hC6k4hndRWaeIVhIjvHu8w"
     std::string id() const;
 
+    /// Gets the unique ID for this DataFile into a string supplied by the caller. When the same string is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// id : The output string.
+    /// Returns true if the value was successfully returned.
+    bool getId(std::string& id) const;
+
+    /// Gets the unique ID for this DataFile, writing it as a null terminated string into a buffer supplied by the caller.
+    /// buffer : The output buffer. Nothing is written if the buffer is too small.
+    /// capacity : The number of characters the buffer can hold, including the terminating null.
+    /// length : The output length of the string, not including the terminating null. This is returned even when the
+    /// buffer is too small, so the call can be repeated with a buffer of at least length + 1 characters.
+    /// Returns true if the value was successfully returned or the buffer was too small. Compare length with
+    /// capacity to know if the value was written.
+    bool getId(char* buffer, size_t capacity, size_t& length) const;
+
     /// Gets the version number of this DataFile.
     int versionNumber() const;
 
@@ -225,6 +255,8 @@ private:
     virtual bool download_raw(const char* path, DataEventHandler* handler) = 0;
     virtual bool refresh_raw(DataEventHandler* handler) = 0;
     virtual bool isComplete_raw() const = 0;
+    virtual bool getName_raw(char* buffer, size_t capacity, size_t& length) const = 0;
+    virtual bool getId_raw(char* buffer, size_t capacity, size_t& length) const = 0;
 };
 
 // Inline wrappers
@@ -242,6 +274,26 @@ inline std::string DataFile::name() const
     return res;
 }
 
+inline bool DataFile::getName(std::string& name) const
+{
+    size_t length = 0;
+    name.resize(name.capacity());
+    bool res = getName_raw(&name[0], name.size() + 1, length);
+    if(res && length > name.size())
+    {
+        name.resize(length);
+        res = getName_raw(&name[0], name.size() + 1, length);
+    }
+    name.resize(res ? length : 0);
+    return res;
+}
+
+inline bool DataFile::getName(char* buffer, size_t capacity, size_t& length) const
+{
+    bool res = getName_raw(buffer, capacity, length);
+    return res;
+}
+
 inline bool DataFile::name(const std::string& value)
 {
     return name__raw(value.c_str());
@@ -285,6 +337,26 @@ inline std::string DataFile::id() const
     return res;
 }
 
+inline bool DataFile::getId(std::string& id) const
+{
+    size_t length = 0;
+    id.resize(id.capacity());
+    bool res = getId_raw(&id[0], id.size() + 1, length);
+    if(res && length > id.size())
+    {
+        id.resize(length);
+        res = getId_raw(&id[0], id.size() + 1, length);
+    }
+    id.resize(res ? length : 0);
+    return res;
+}
+
+inline bool DataFile::getId(char* buffer, size_t capacity, size_t& length) const
+{
+    bool res = getId_raw(buffer, capacity, length);
+    return res;
+}
+
 inline int DataFile::versionNumber() const
 {
     int res = versionNumber_raw();
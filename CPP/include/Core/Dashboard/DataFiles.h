@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
 #include <vector>
 
@@ -52,6 +53,12 @@ public:
     /// Returns the file or null if a file with the specified ID is not found.
     Ptr<DataFile> itemById(const std::string& id) const;
 
+    /// Returns the items that match a set of unique IDs in a single call, instead of one call to itemById for each ID.
+    /// ids : The unique IDs of the items to return.
+    /// Returns an array the same length as ids where each entry is the file with the corresponding id, or
+    /// null if the id doesn't match an item within the collection.
+    std::vector<Ptr<DataFile>> itemsById(const std::vector<std::string>& ids) const;
+
     /// Get the current list of all files.
     /// Returns the current list of all files.
     std::vector<Ptr<DataFile>> asArray() const;
@@ -71,6 +78,7 @@ private:
     virtual size_t count_raw() const = 0;
     virtual DataFile* itemById_raw(const char* id) const = 0;
     virtual DataFile** asArray_raw(size_t& return_size) const = 0;
+    virtual DataFile** itemsById_raw(const char** ids, size_t ids_size, size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -93,6 +101,26 @@ inline Ptr<DataFile> DataFiles::itemById(const std::string& id) const
     return res;
 }
 
+inline std::vector<Ptr<DataFile>> DataFiles::itemsById(const std::vector<std::string>& ids) const
+{
+    ScratchArray<const char*> ids_(ids.size());
+    for(size_t i = 0; i < ids.size(); ++i)
+    {
+        ids_[i] = ids[i].c_str();
+    }
+
+    std::vector<Ptr<DataFile>> res;
+    size_t s;
+
+    DataFile** p= itemsById_raw(ids_, ids.size(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 inline std::vector<Ptr<DataFile>> DataFiles::asArray() const
 {
     std::vector<Ptr<DataFile>> res;
@@ -109,7 +137,7 @@ inline std::vector<Ptr<DataFile>> DataFiles::asArray() const
 
 template <class OutputIterator> inline void DataFiles::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
 #include <vector>
 
@@ -173,14 +174,13 @@ inline Ptr<DataFileFuture> DataFolder::uploadFile(const std::string& filename)
 
 inline Ptr<DataFileFuture> DataFolder::uploadAssembly(const std::vector<std::string>& filenames)
 {
-    const char** filenames_ = filenames.empty() ? nullptr : (new const char*[filenames.size()]);
+    ScratchArray<const char*> filenames_(filenames.size());
     for(size_t i = 0; i < filenames.size(); ++i)
     {
         filenames_[i] = filenames[i].c_str();
     }
 
     Ptr<DataFileFuture> res = uploadAssembly_raw(filenames_, filenames.size());
-    delete[] filenames_;
     return res;
 }
 
@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
 #include <vector>
 
@@ -48,6 +49,12 @@ public:
     /// Returns the folder or null if a folder of the specified name is not found.
     Ptr<DataFolder> itemByName(const std::string& name) const;
 
+    /// Returns the items that match a set of names in a single call, instead of one call to itemByName for each name.
+    /// names : The names of the items to return.
+    /// Returns an array the same length as names where each entry is the folder with the corresponding name, or
+    /// null if the name doesn't match an item within the collection.
+    std::vector<Ptr<DataFolder>> itemsByName(const std::vector<std::string>& names) const;
+
     /// The number of folders in this collection.
     size_t count() const;
 
@@ -57,6 +64,12 @@ public:
     /// Returns the folder or null if a folder with the specified ID is not found.
     Ptr<DataFolder> itemById(const std::string& id) const;
 
+    /// Returns the items that match a set of unique IDs in a single call, instead of one call to itemById for each ID.
+    /// ids : The unique IDs of the items to return.
+    /// Returns an array the same length as ids where each entry is the folder with the corresponding id, or
+    /// null if the id doesn't match an item within the collection.
+    std::vector<Ptr<DataFolder>> itemsById(const std::vector<std::string>& ids) const;
+
     /// Creates a new folder within the parent folder.
     /// name : The name of the folder. This must be unique with respect to the other folders within the parent folder.
     /// Returns the created DataFolder or null if the creation failed.
@@ -83,6 +96,8 @@ private:
     virtual DataFolder* itemById_raw(const char* id) const = 0;
     virtual DataFolder* add_raw(const char* name) = 0;
     virtual DataFolder** asArray_raw(size_t& return_size) const = 0;
+    virtual DataFolder** itemsById_raw(const char** ids, size_t ids_size, size_t& return_size) const = 0;
+    virtual DataFolder** itemsByName_raw(const char** names, size_t names_size, size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -99,6 +114,26 @@ inline Ptr<DataFolder> DataFolders::itemByName(const std::string& name) const
     return res;
 }
 
+inline std::vector<Ptr<DataFolder>> DataFolders::itemsByName(const std::vector<std::string>& names) const
+{
+    ScratchArray<const char*> names_(names.size());
+    for(size_t i = 0; i < names.size(); ++i)
+    {
+        names_[i] = names[i].c_str();
+    }
+
+    std::vector<Ptr<DataFolder>> res;
+    size_t s;
+
+    DataFolder** p= itemsByName_raw(names_, names.size(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 inline size_t DataFolders::count() const
 {
     size_t res = count_raw();
@@ -111,6 +146,26 @@ inline Ptr<DataFolder> DataFolders::itemById(const std::string& id) const
     return res;
 }
 
+inline std::vector<Ptr<DataFolder>> DataFolders::itemsById(const std::vector<std::string>& ids) const
+{
+    ScratchArray<const char*> ids_(ids.size());
+    for(size_t i = 0; i < ids.size(); ++i)
+    {
+        ids_[i] = ids[i].c_str();
+    }
+
+    std::vector<Ptr<DataFolder>> res;
+    size_t s;
+
+    DataFolder** p= itemsById_raw(ids_, ids.size(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 inline Ptr<DataFolder> DataFolders::add(const std::string& name)
 {
     Ptr<DataFolder> res = add_raw(name.c_str());
@@ -133,7 +188,7 @@ inline std::vector<Ptr<DataFolder>> DataFolders::asArray() const
 
 template <class OutputIterator> inline void DataFolders::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -109,7 +109,7 @@ inline std::vector<Ptr<DataHub>> DataHubs::asArray() const
 
 template <class OutputIterator> inline void DataHubs::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
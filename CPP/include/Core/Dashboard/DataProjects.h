@@ -124,7 +124,7 @@ inline std::vector<Ptr<DataProject>> DataProjects::asArray() const
 
 template <class OutputIterator> inline void DataProjects::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
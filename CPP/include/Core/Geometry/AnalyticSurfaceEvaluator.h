@@ -0,0 +1,724 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include "../Base.h"
+#include "../CoreTypeDefs.h"
+#include "Surface.h"
+#include "Plane.h"
+#include "Cylinder.h"
+#include "Cone.h"
+#include "Sphere.h"
+#include "Torus.h"
+#include "EllipticalCylinder.h"
+#include "EllipticalCone.h"
+#include "Point3D.h"
+#include "Vector3D.h"
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+// THIS CLASS IS USED BY AN API CLIENT
+// It is implemented entirely in this header and does not call into Fusion 360
+// once it has been constructed.
+
+namespace adsk { namespace core {
+
+namespace analytic_detail {
+
+struct Vec3
+{
+    double x, y, z;
+};
+
+inline Vec3 makeVec3(double x, double y, double z) { Vec3 v = { x, y, z }; return v; }
+inline Vec3 operator+(const Vec3& a, const Vec3& b) { return makeVec3(a.x + b.x, a.y + b.y, a.z + b.z); }
+inline Vec3 operator-(const Vec3& a, const Vec3& b) { return makeVec3(a.x - b.x, a.y - b.y, a.z - b.z); }
+inline Vec3 operator*(double s, const Vec3& a) { return makeVec3(s * a.x, s * a.y, s * a.z); }
+inline double dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline Vec3 cross(const Vec3& a, const Vec3& b) { return makeVec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x); }
+inline double length(const Vec3& a) { return std::sqrt(dot(a, a)); }
+
+inline Vec3 normalized(const Vec3& a)
+{
+    double len = length(a);
+    return len > 0.0 ? (1.0 / len) * a : a;
+}
+
+inline Vec3 load(const double* p) { return makeVec3(p[0], p[1], p[2]); }
+inline void store(const Vec3& a, double* p) { p[0] = a.x; p[1] = a.y; p[2] = a.z; }
+
+inline Vec3 toVec3(const Ptr<Point3D>& point) { return point ? makeVec3(point->x(), point->y(), point->z()) : makeVec3(0, 0, 0); }
+inline Vec3 toVec3(const Ptr<Vector3D>& vector) { return vector ? makeVec3(vector->x(), vector->y(), vector->z()) : makeVec3(0, 0, 0); }
+
+const double twoPi = 6.283185307179586476925286766559;
+
+// Angle of a direction in the plane of the frame, normalized to [0, 2pi).
+inline double angleOf(double x, double y)
+{
+    double angle = std::atan2(y, x);
+    return angle < 0.0 ? angle + twoPi : angle;
+}
+
+// Orthonormal frame. zAxis is the axis of the surface and xAxis the reference direction.
+struct Frame
+{
+    Vec3 origin, xAxis, yAxis, zAxis;
+
+    void set(const Vec3& origin_, const Vec3& axis, const Vec3& reference)
+    {
+        origin = origin_;
+        zAxis = normalized(axis);
+        xAxis = normalized(reference - dot(reference, zAxis) * zAxis);
+        if (length(xAxis) == 0.0)
+        {
+            // No usable reference direction, so choose one perpendicular to the axis.
+            Vec3 seed = std::fabs(zAxis.x) < 0.9 ? makeVec3(1, 0, 0) : makeVec3(0, 1, 0);
+            xAxis = normalized(seed - dot(seed, zAxis) * zAxis);
+        }
+        yAxis = cross(zAxis, xAxis);
+    }
+
+    Vec3 toModel(double x, double y, double z) const { return origin + x * xAxis + y * yAxis + z * zAxis; }
+    Vec3 toModelDirection(double x, double y, double z) const { return x * xAxis + y * yAxis + z * zAxis; }
+
+    Vec3 toLocal(const Vec3& point) const
+    {
+        Vec3 d = point - origin;
+        return makeVec3(dot(d, xAxis), dot(d, yAxis), dot(d, zAxis));
+    }
+};
+
+// Returns the angle u of the point (a cos u, b sin u) on an ellipse that is closest to (x, y).
+// The closest point lies in the same quadrant as (x, y), so the root of the distance derivative is
+// bracketed in the first quadrant and found with a safeguarded Newton iteration. On the major axis
+// the derivative is also zero at the near vertex, which is the farthest point when (x, y) is
+// inside the evolute, so that case is solved in closed form.
+inline double closestEllipseAngle(double a, double b, double x, double y)
+{
+    double ax = std::fabs(x), ay = std::fabs(y);
+    if (ay == 0.0)
+    {
+        double u = a * ax < a * a - b * b ? std::acos(a * ax / (a * a - b * b)) : 0.0;
+        if (x < 0.0)
+            u = twoPi / 2.0 - u;
+        return u;
+    }
+    double lo = 0.0, hi = twoPi / 4.0;
+    double u = std::atan2(a * ay, b * ax);
+    for (int i = 0; i < 32; ++i)
+    {
+        double s = std::sin(u), c = std::cos(u);
+        double g = (a * a - b * b) * s * c - ax * a * s + ay * b * c;
+        if (g > 0.0)
+            lo = u;
+        else
+            hi = u;
+        double dg = (a * a - b * b) * (c * c - s * s) - ax * a * c - ay * b * s;
+        double next = dg != 0.0 ? u - g / dg : 0.5 * (lo + hi);
+        // Test for convergence before the bracket, because at the root the step can round onto
+        // the end of the bracket that was just moved to u.
+        if (std::fabs(next - u) < 1.0e-15)
+        {
+            u = next;
+            break;
+        }
+        if (!(next > lo && next < hi))
+            next = 0.5 * (lo + hi);
+        u = next;
+    }
+    if (x < 0.0)
+        u = twoPi / 2.0 - u;
+    if (y < 0.0)
+        u = twoPi - u;
+    return u >= twoPi ? u - twoPi : u;
+}
+
+// Signed principal curvatures from the first and second derivatives, positive where the
+// surface curves away from the normal.
+inline void principalCurvatures(const Vec3& pu, const Vec3& pv, const Vec3& puu, const Vec3& puv, const Vec3& pvv, const Vec3& normal,
+                                double& maxCurvature, double& minCurvature)
+{
+    double E = dot(pu, pu), F = dot(pu, pv), G = dot(pv, pv);
+    double L = -dot(puu, normal), M = -dot(puv, normal), N = -dot(pvv, normal);
+    double det = E * G - F * F;
+    if (det <= 0.0)
+    {
+        maxCurvature = minCurvature = 0.0;
+        return;
+    }
+    double K = (L * N - M * M) / det;
+    double H = (E * N - 2.0 * F * M + G * L) / (2.0 * det);
+    double disc = H * H - K;
+    double root = disc > 0.0 ? std::sqrt(disc) : 0.0;
+    maxCurvature = H + root;
+    minCurvature = H - root;
+}
+
+} // namespace analytic_detail
+
+/// Base class of the closed-form surface evaluators. It provides the batch kernels, which process
+/// flat arrays of coordinates, by calling the inline single position kernels of the derived class
+/// so the per-type math is resolved at compile time and no virtual calls are made.
+/// All arrays are flat: parameter arrays are in the form [u0, v0, u1, v1, ...] and point and
+/// vector arrays are in the form [x0, y0, z0, x1, y1, z1, ...].
+template <class Derived>
+class AnalyticSurfaceEvaluatorBase {
+public:
+
+    /// Indicates if the evaluator was successfully initialized from its surface.
+    bool isValid() const { return m_isValid; }
+
+    /// Gets the points on the surface at a number of parameter positions.
+    /// parameters : The array of count parameter positions.
+    /// count : The number of parameter positions.
+    /// points : The output array that receives count points.
+    void getPointsAtParameters(const double* parameters, size_t count, double* points) const
+    {
+        for (size_t i = 0; i < count; ++i)
+            derived().pointAtParameter(parameters[2 * i], parameters[2 * i + 1], points + 3 * i);
+    }
+
+    /// Gets the unit surface normals at a number of parameter positions.
+    /// parameters : The array of count parameter positions.
+    /// count : The number of parameter positions.
+    /// normals : The output array that receives count normals.
+    void getNormalsAtParameters(const double* parameters, size_t count, double* normals) const
+    {
+        for (size_t i = 0; i < count; ++i)
+            derived().normalAtParameter(parameters[2 * i], parameters[2 * i + 1], normals + 3 * i);
+    }
+
+    /// Gets the parameter positions of the points on the surface nearest to a number of points.
+    /// points : The array of count points.
+    /// count : The number of points.
+    /// parameters : The output array that receives count parameter positions.
+    void getParametersAtPoints(const double* points, size_t count, double* parameters) const
+    {
+        for (size_t i = 0; i < count; ++i)
+            derived().parameterAtPoint(points + 3 * i, parameters[2 * i], parameters[2 * i + 1]);
+    }
+
+    /// Gets the unit surface normals at a number of points. For reliable results the points
+    /// should lie on the surface.
+    /// points : The array of count points.
+    /// count : The number of points.
+    /// normals : The output array that receives count normals.
+    void getNormalsAtPoints(const double* points, size_t count, double* normals) const
+    {
+        for (size_t i = 0; i < count; ++i)
+            derived().normalAtPoint(points + 3 * i, normals + 3 * i);
+    }
+
+    /// Gets the principal curvatures at a number of points. For reliable results the points
+    /// should lie on the surface. Curvatures are signed with respect to the surface normal, where
+    /// a negative curvature indicates the surface is concave in that direction.
+    /// points : The array of count points.
+    /// count : The number of points.
+    /// maxCurvatures : The output array that receives count maximum principal curvatures.
+    /// minCurvatures : The output array that receives count minimum principal curvatures.
+    void getCurvaturesAtPoints(const double* points, size_t count, double* maxCurvatures, double* minCurvatures) const
+    {
+        for (size_t i = 0; i < count; ++i)
+            derived().curvatureAtPoint(points + 3 * i, maxCurvatures[i], minCurvatures[i]);
+    }
+
+    /// Single position kernels. A derived class provides pointAtParameter, normalAtParameter,
+    /// parameterAtPoint and curvatureAtParameter, and can replace the point based kernels
+    /// below when it has a more direct form.
+    void normalAtPoint(const double* point, double* normal) const
+    {
+        double u, v;
+        derived().parameterAtPoint(point, u, v);
+        derived().normalAtParameter(u, v, normal);
+    }
+
+    void curvatureAtPoint(const double* point, double& maxCurvature, double& minCurvature) const
+    {
+        double u, v;
+        derived().parameterAtPoint(point, u, v);
+        derived().curvatureAtParameter(u, v, maxCurvature, minCurvature);
+    }
+
+protected:
+
+    AnalyticSurfaceEvaluatorBase() : m_isValid(false) {}
+
+    const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+    analytic_detail::Frame m_frame;
+    bool m_isValid;
+};
+
+/// Closed-form evaluator for one of the primitive surface types, selected at compile time by
+/// its SurfaceTypes value. It is constructed from the transient surface using its getData
+/// information and evaluates positions, normals, point inversion and curvature without calling
+/// back into Fusion 360 and without iteration, except for the elliptical types where the
+/// projection onto an ellipse uses a bracketed one-dimensional root find.
+///
+/// Each evaluator uses the natural parameterization of its surface, described with each type.
+/// This is not necessarily the same parameterization used by the SurfaceEvaluator of the surface,
+/// so parameters should only be exchanged between evaluators of the same kind. Points, normals
+/// and curvatures do not depend on the parameterization.
+///
+/// There is no evaluator for NurbsSurfaceType. Use dispatchAnalyticSurface to select the
+/// evaluator for a surface whose type is only known at runtime.
+template <SurfaceTypes type>
+class AnalyticSurfaceEvaluator;
+
+/// Plane: P(u, v) = origin + u * uDirection + v * vDirection.
+template <>
+class AnalyticSurfaceEvaluator<PlaneSurfaceType> : public AnalyticSurfaceEvaluatorBase<AnalyticSurfaceEvaluator<PlaneSurfaceType>> {
+public:
+    typedef Plane surface_type;
+
+    explicit AnalyticSurfaceEvaluator(const Ptr<Plane>& plane)
+    {
+        using namespace analytic_detail;
+        if (!plane)
+            return;
+        Vec3 normal = toVec3(plane->normal());
+        m_frame.set(toVec3(plane->origin()), normal, toVec3(plane->uDirection()));
+        m_isValid = length(normal) > 0.0;
+    }
+
+    void pointAtParameter(double u, double v, double* point) const { analytic_detail::store(m_frame.toModel(u, v, 0.0), point); }
+    void normalAtParameter(double, double, double* normal) const { analytic_detail::store(m_frame.zAxis, normal); }
+
+    void parameterAtPoint(const double* point, double& u, double& v) const
+    {
+        analytic_detail::Vec3 local = m_frame.toLocal(analytic_detail::load(point));
+        u = local.x;
+        v = local.y;
+    }
+
+    void curvatureAtParameter(double, double, double& maxCurvature, double& minCurvature) const { maxCurvature = minCurvature = 0.0; }
+    void normalAtPoint(const double*, double* normal) const { analytic_detail::store(m_frame.zAxis, normal); }
+    void curvatureAtPoint(const double*, double& maxCurvature, double& minCurvature) const { maxCurvature = minCurvature = 0.0; }
+};
+
+/// Cylinder: P(u, v) = origin + radius * (cos(u) * X + sin(u) * Y) + v * axis, where u is in [0, 2pi).
+template <>
+class AnalyticSurfaceEvaluator<CylinderSurfaceType> : public AnalyticSurfaceEvaluatorBase<AnalyticSurfaceEvaluator<CylinderSurfaceType>> {
+public:
+    typedef Cylinder surface_type;
+
+    explicit AnalyticSurfaceEvaluator(const Ptr<Cylinder>& cylinder) : m_radius(0.0)
+    {
+        using namespace analytic_detail;
+        Ptr<Point3D> origin;
+        Ptr<Vector3D> axis;
+        if (!cylinder || !cylinder->getData(origin, axis, m_radius))
+            return;
+        m_frame.set(toVec3(origin), toVec3(axis), makeVec3(0, 0, 0));
+        m_isValid = m_radius > 0.0;
+    }
+
+    void pointAtParameter(double u, double v, double* point) const
+    {
+        analytic_detail::store(m_frame.toModel(m_radius * std::cos(u), m_radius * std::sin(u), v), point);
+    }
+
+    void normalAtParameter(double u, double, double* normal) const
+    {
+        analytic_detail::store(m_frame.toModelDirection(std::cos(u), std::sin(u), 0.0), normal);
+    }
+
+    void parameterAtPoint(const double* point, double& u, double& v) const
+    {
+        analytic_detail::Vec3 local = m_frame.toLocal(analytic_detail::load(point));
+        u = analytic_detail::angleOf(local.x, local.y);
+        v = local.z;
+    }
+
+    void curvatureAtParameter(double, double, double& maxCurvature, double& minCurvature) const
+    {
+        maxCurvature = 1.0 / m_radius;
+        minCurvature = 0.0;
+    }
+
+    void curvatureAtPoint(const double*, double& maxCurvature, double& minCurvature) const { curvatureAtParameter(0.0, 0.0, maxCurvature, minCurvature); }
+
+private:
+    double m_radius;
+};
+
+/// Cone: P(u, v) = origin + (radius + v * tan(halfAngle)) * (cos(u) * X + sin(u) * Y) + v * axis,
+/// where u is in [0, 2pi). The surface ends at the apex, where the radius becomes zero.
+template <>
+class AnalyticSurfaceEvaluator<ConeSurfaceType> : public AnalyticSurfaceEvaluatorBase<AnalyticSurfaceEvaluator<ConeSurfaceType>> {
+public:
+    typedef Cone surface_type;
+
+    explicit AnalyticSurfaceEvaluator(const Ptr<Cone>& cone) : m_radius(0.0), m_sinAngle(0.0), m_cosAngle(1.0)
+    {
+        using namespace analytic_detail;
+        Ptr<Point3D> origin;
+        Ptr<Vector3D> axis;
+        double halfAngle = 0.0;
+        if (!cone || !cone->getData(origin, axis, m_radius, halfAngle))
+            return;
+        m_frame.set(toVec3(origin), toVec3(axis), makeVec3(0, 0, 0));
+        m_sinAngle = std::sin(halfAngle);
+        m_cosAngle = std::cos(halfAngle);
+        m_isValid = m_radius > 0.0 && m_cosAngle > 0.0;
+    }
+
+    void pointAtParameter(double u, double v, double* point) const
+    {
+        double rho = radiusAt(v);
+        analytic_detail::store(m_frame.toModel(rho * std::cos(u), rho * std::sin(u), v), point);
+    }
+
+    void normalAtParameter(double u, double, double* normal) const
+    {
+        analytic_detail::store(m_frame.toModelDirection(m_cosAngle * std::cos(u), m_cosAngle * std::sin(u), -m_sinAngle), normal);
+    }
+
+    // The nearest point is the foot of the perpendicular onto the generating line in the
+    // half plane that contains the point and the axis, clamped to the apex.
+    void parameterAtPoint(const double* point, double& u, double& v) const
+    {
+        analytic_detail::Vec3 local = m_frame.toLocal(analytic_detail::load(point));
+        double rho = std::sqrt(local.x * local.x + local.y * local.y);
+        u = analytic_detail::angleOf(local.x, local.y);
+        double t = (rho - m_radius) * m_sinAngle + local.z * m_cosAngle;
+        if (m_radius + t * m_sinAngle < 0.0)
+            t = -m_radius / m_sinAngle;
+        v = t * m_cosAngle;
+    }
+
+    void curvatureAtParameter(double, double v, double& maxCurvature, double& minCurvature) const
+    {
+        double rho = radiusAt(v);
+        maxCurvature = rho > 0.0 ? m_cosAngle / rho : std::numeric_limits<double>::max();
+        minCurvature = 0.0;
+    }
+
+private:
+    double radiusAt(double v) const { return m_radius + v * m_sinAngle / m_cosAngle; }
+
+    double m_radius;
+    double m_sinAngle;
+    double m_cosAngle;
+};
+
+/// Sphere: P(u, v) = origin + radius * (cos(v) * (cos(u) * X + sin(u) * Y) + sin(v) * Z),
+/// where u is in [0, 2pi) and v is in [-pi/2, pi/2], and X, Y and Z are the model axes.
+template <>
+class AnalyticSurfaceEvaluator<SphereSurfaceType> : public AnalyticSurfaceEvaluatorBase<AnalyticSurfaceEvaluator<SphereSurfaceType>> {
+public:
+    typedef Sphere surface_type;
+
+    explicit AnalyticSurfaceEvaluator(const Ptr<Sphere>& sphere) : m_radius(0.0)
+    {
+        using namespace analytic_detail;
+        Ptr<Point3D> origin;
+        if (!sphere || !sphere->getData(origin, m_radius))
+            return;
+        m_frame.set(toVec3(origin), makeVec3(0, 0, 1), makeVec3(1, 0, 0));
+        m_isValid = m_radius > 0.0;
+    }
+
+    void pointAtParameter(double u, double v, double* point) const
+    {
+        double n[3];
+        normalAtParameter(u, v, n);
+        analytic_detail::store(m_frame.origin + m_radius * analytic_detail::load(n), point);
+    }
+
+    void normalAtParameter(double u, double v, double* normal) const
+    {
+        double c = std::cos(v);
+        analytic_detail::store(m_frame.toModelDirection(c * std::cos(u), c * std::sin(u), std::sin(v)), normal);
+    }
+
+    void parameterAtPoint(const double* point, double& u, double& v) const
+    {
+        analytic_detail::Vec3 local = m_frame.toLocal(analytic_detail::load(point));
+        u = analytic_detail::angleOf(local.x, local.y);
+        v = std::atan2(local.z, std::sqrt(local.x * local.x + local.y * local.y));
+    }
+
+    void curvatureAtParameter(double, double, double& maxCurvature, double& minCurvature) const { maxCurvature = minCurvature = 1.0 / m_radius; }
+
+    void normalAtPoint(const double* point, double* normal) const
+    {
+        analytic_detail::store(analytic_detail::normalized(analytic_detail::load(point) - m_frame.origin), normal);
+    }
+
+    void curvatureAtPoint(const double*, double& maxCurvature, double& minCurvature) const { curvatureAtParameter(0.0, 0.0, maxCurvature, minCurvature); }
+
+private:
+    double m_radius;
+};
+
+/// Torus: P(u, v) = origin + (majorRadius + minorRadius * cos(v)) * (cos(u) * X + sin(u) * Y) + minorRadius * sin(v) * axis,
+/// where u and v are in [0, 2pi).
+template <>
+class AnalyticSurfaceEvaluator<TorusSurfaceType> : public AnalyticSurfaceEvaluatorBase<AnalyticSurfaceEvaluator<TorusSurfaceType>> {
+public:
+    typedef Torus surface_type;
+
+    explicit AnalyticSurfaceEvaluator(const Ptr<Torus>& torus) : m_majorRadius(0.0), m_minorRadius(0.0)
+    {
+        using namespace analytic_detail;
+        Ptr<Point3D> origin;
+        Ptr<Vector3D> axis;
+        if (!torus || !torus->getData(origin, axis, m_majorRadius, m_minorRadius))
+            return;
+        m_frame.set(toVec3(origin), toVec3(axis), makeVec3(0, 0, 0));
+        m_isValid = m_minorRadius > 0.0 && m_majorRadius > 0.0;
+    }
+
+    void pointAtParameter(double u, double v, double* point) const
+    {
+        double rho = m_majorRadius + m_minorRadius * std::cos(v);
+        analytic_detail::store(m_frame.toModel(rho * std::cos(u), rho * std::sin(u), m_minorRadius * std::sin(v)), point);
+    }
+
+    void normalAtParameter(double u, double v, double* normal) const
+    {
+        double c = std::cos(v);
+        analytic_detail::store(m_frame.toModelDirection(c * std::cos(u), c * std::sin(u), std::sin(v)), normal);
+    }
+
+    void parameterAtPoint(const double* point, double& u, double& v) const
+    {
+        analytic_detail::Vec3 local = m_frame.toLocal(analytic_detail::load(point));
+        double rho = std::sqrt(local.x * local.x + local.y * local.y);
+        u = analytic_detail::angleOf(local.x, local.y);
+        v = analytic_detail::angleOf(rho - m_majorRadius, local.z);
+    }
+
+    void curvatureAtParameter(double, double v, double& maxCurvature, double& minCurvature) const
+    {
+        double c = std::cos(v);
+        double tube = 1.0 / m_minorRadius;
+        double ring = c / (m_majorRadius + m_minorRadius * c);
+        maxCurvature = tube > ring ? tube : ring;
+        minCurvature = tube > ring ? ring : tube;
+    }
+
+private:
+    double m_majorRadius;
+    double m_minorRadius;
+};
+
+/// Elliptical cylinder: P(u, v) = origin + majorRadius * cos(u) * majorAxis + minorRadius * sin(u) * Y + v * axis,
+/// where u is in [0, 2pi).
+template <>
+class AnalyticSurfaceEvaluator<EllipticalCylinderSurfaceType> : public AnalyticSurfaceEvaluatorBase<AnalyticSurfaceEvaluator<EllipticalCylinderSurfaceType>> {
+public:
+    typedef EllipticalCylinder surface_type;
+
+    explicit AnalyticSurfaceEvaluator(const Ptr<EllipticalCylinder>& cylinder) : m_majorRadius(0.0), m_minorRadius(0.0)
+    {
+        using namespace analytic_detail;
+        Ptr<Point3D> origin;
+        Ptr<Vector3D> axis, majorAxis;
+        if (!cylinder || !cylinder->getData(origin, axis, majorAxis, m_majorRadius, m_minorRadius))
+            return;
+        m_frame.set(toVec3(origin), toVec3(axis), toVec3(majorAxis));
+        m_isValid = m_majorRadius > 0.0 && m_minorRadius > 0.0;
+    }
+
+    void pointAtParameter(double u, double v, double* point) const
+    {
+        analytic_detail::store(m_frame.toModel(m_majorRadius * std::cos(u), m_minorRadius * std::sin(u), v), point);
+    }
+
+    void normalAtParameter(double u, double, double* normal) const
+    {
+        analytic_detail::store(analytic_detail::normalized(m_frame.toModelDirection(m_minorRadius * std::cos(u), m_majorRadius * std::sin(u), 0.0)), normal);
+    }
+
+    void parameterAtPoint(const double* point, double& u, double& v) const
+    {
+        analytic_detail::Vec3 local = m_frame.toLocal(analytic_detail::load(point));
+        u = analytic_detail::closestEllipseAngle(m_majorRadius, m_minorRadius, local.x, local.y);
+        v = local.z;
+    }
+
+    void curvatureAtParameter(double u, double, double& maxCurvature, double& minCurvature) const
+    {
+        double s = std::sin(u), c = std::cos(u);
+        double q = m_majorRadius * m_majorRadius * s * s + m_minorRadius * m_minorRadius * c * c;
+        maxCurvature = m_majorRadius * m_minorRadius / (q * std::sqrt(q));
+        minCurvature = 0.0;
+    }
+
+private:
+    double m_majorRadius;
+    double m_minorRadius;
+};
+
+/// Elliptical cone: P(u, v) = origin + k(v) * (majorRadius * cos(u) * majorAxis + minorRadius * sin(u) * Y) + v * axis,
+/// where k(v) = 1 + v * tan(halfAngle) / majorRadius and u is in [0, 2pi). The cross section at any
+/// height is an ellipse similar to the one at the origin.
+template <>
+class AnalyticSurfaceEvaluator<EllipticalConeSurfaceType> : public AnalyticSurfaceEvaluatorBase<AnalyticSurfaceEvaluator<EllipticalConeSurfaceType>> {
+public:
+    typedef EllipticalCone surface_type;
+
+    explicit AnalyticSurfaceEvaluator(const Ptr<EllipticalCone>& cone) : m_majorRadius(0.0), m_minorRadius(0.0), m_slope(0.0)
+    {
+        using namespace analytic_detail;
+        Ptr<Point3D> origin;
+        Ptr<Vector3D> axis, majorAxis;
+        double halfAngle = 0.0;
+        if (!cone || !cone->getData(origin, axis, majorAxis, m_majorRadius, m_minorRadius, halfAngle))
+            return;
+        m_frame.set(toVec3(origin), toVec3(axis), toVec3(majorAxis));
+        m_isValid = m_majorRadius > 0.0 && m_minorRadius > 0.0 && std::cos(halfAngle) > 0.0;
+        if (m_isValid)
+            m_slope = std::tan(halfAngle) / m_majorRadius;
+    }
+
+    void pointAtParameter(double u, double v, double* point) const
+    {
+        double k = scaleAt(v);
+        analytic_detail::store(m_frame.toModel(k * m_majorRadius * std::cos(u), k * m_minorRadius * std::sin(u), v), point);
+    }
+
+    void normalAtParameter(double u, double v, double* normal) const
+    {
+        analytic_detail::Vec3 pu, pv, puu, puv, pvv;
+        derivatives(u, v, pu, pv, puu, puv, pvv);
+        analytic_detail::store(analytic_detail::normalized(analytic_detail::cross(pu, pv)), normal);
+    }
+
+    // The cross section ellipse at the height of the point gives the starting position, which is
+    // exact for points on the surface. Off surface points are refined with Newton steps on the
+    // squared distance, falling back to Gauss-Newton steps where its Hessian isn't positive definite.
+    void parameterAtPoint(const double* point, double& u, double& v) const
+    {
+        using namespace analytic_detail;
+        Vec3 target = load(point);
+        Vec3 local = m_frame.toLocal(target);
+        v = local.z;
+        double k = scaleAt(v);
+        if (k <= 0.0)
+        {
+            u = angleOf(local.x, local.y);
+            return;
+        }
+        u = closestEllipseAngle(k * m_majorRadius, k * m_minorRadius, local.x, local.y);
+        for (int i = 0; i < 8; ++i)
+        {
+            double p[3];
+            pointAtParameter(u, v, p);
+            Vec3 r = load(p) - target;
+            Vec3 pu, pv, puu, puv, pvv;
+            derivatives(u, v, pu, pv, puu, puv, pvv);
+            double a11 = dot(pu, pu), a12 = dot(pu, pv), a22 = dot(pv, pv);
+            double h11 = a11 + dot(r, puu), h12 = a12 + dot(r, puv), h22 = a22 + dot(r, pvv);
+            if (h11 > 0.0 && h11 * h22 - h12 * h12 > 0.0)
+            {
+                a11 = h11;
+                a12 = h12;
+                a22 = h22;
+            }
+            double b1 = -dot(r, pu), b2 = -dot(r, pv);
+            double det = a11 * a22 - a12 * a12;
+            if (det <= 0.0)
+                break;
+            double du = (b1 * a22 - b2 * a12) / det;
+            double dv = (a11 * b2 - a12 * b1) / det;
+            u += du;
+            v += dv;
+            if (std::fabs(du) + std::fabs(dv) < 1.0e-14)
+                break;
+        }
+        if (u < 0.0 || u >= twoPi)
+            u -= twoPi * std::floor(u / twoPi);
+    }
+
+    void curvatureAtParameter(double u, double v, double& maxCurvature, double& minCurvature) const
+    {
+        analytic_detail::Vec3 pu, pv, puu, puv, pvv;
+        derivatives(u, v, pu, pv, puu, puv, pvv);
+        analytic_detail::Vec3 normal = analytic_detail::normalized(analytic_detail::cross(pu, pv));
+        analytic_detail::principalCurvatures(pu, pv, puu, puv, pvv, normal, maxCurvature, minCurvature);
+    }
+
+private:
+    double scaleAt(double v) const { return 1.0 + v * m_slope; }
+
+    void derivatives(double u, double v, analytic_detail::Vec3& pu, analytic_detail::Vec3& pv,
+                     analytic_detail::Vec3& puu, analytic_detail::Vec3& puv, analytic_detail::Vec3& pvv) const
+    {
+        double k = scaleAt(v);
+        double ac = m_majorRadius * std::cos(u), bs = m_minorRadius * std::sin(u);
+        double as = m_majorRadius * std::sin(u), bc = m_minorRadius * std::cos(u);
+        pu = m_frame.toModelDirection(-k * as, k * bc, 0.0);
+        pv = m_frame.toModelDirection(m_slope * ac, m_slope * bs, 1.0);
+        puu = m_frame.toModelDirection(-k * ac, -k * bs, 0.0);
+        puv = m_frame.toModelDirection(-m_slope * as, m_slope * bc, 0.0);
+        pvv = analytic_detail::makeVec3(0, 0, 0);
+    }
+
+    double m_majorRadius;
+    double m_minorRadius;
+    double m_slope;
+};
+
+namespace analytic_detail {
+
+template <SurfaceTypes type, class Function>
+inline bool invokeWithEvaluator(const Ptr<Surface>& surface, Function& function)
+{
+    Ptr<typename AnalyticSurfaceEvaluator<type>::surface_type> typedSurface = surface;
+    AnalyticSurfaceEvaluator<type> evaluator(typedSurface);
+    if (!evaluator.isValid())
+        return false;
+    function(evaluator);
+    return true;
+}
+
+} // namespace analytic_detail
+
+/// Calls a function object with the closed-form evaluator that matches the type of a surface.
+/// The function object must accept every AnalyticSurfaceEvaluator specialization, for example
+/// a generic lambda or a class with a templated function call operator, so the code it runs is
+/// compiled separately for each surface type.
+/// surface : The surface to create the evaluator for.
+/// function : The function object to call with the evaluator.
+/// Returns true if the function was called. Returns false if the surface is null, is a NURBS
+/// surface, or its data could not be read.
+template <class Function>
+inline bool dispatchAnalyticSurface(const Ptr<Surface>& surface, Function&& function)
+{
+    if (!surface)
+        return false;
+
+    switch (surface->surfaceType())
+    {
+    case PlaneSurfaceType:
+        return analytic_detail::invokeWithEvaluator<PlaneSurfaceType>(surface, function);
+    case CylinderSurfaceType:
+        return analytic_detail::invokeWithEvaluator<CylinderSurfaceType>(surface, function);
+    case ConeSurfaceType:
+        return analytic_detail::invokeWithEvaluator<ConeSurfaceType>(surface, function);
+    case SphereSurfaceType:
+        return analytic_detail::invokeWithEvaluator<SphereSurfaceType>(surface, function);
+    case TorusSurfaceType:
+        return analytic_detail::invokeWithEvaluator<TorusSurfaceType>(surface, function);
+    case EllipticalCylinderSurfaceType:
+        return analytic_detail::invokeWithEvaluator<EllipticalCylinderSurfaceType>(surface, function);
+    case EllipticalConeSurfaceType:
+        return analytic_detail::invokeWithEvaluator<EllipticalConeSurfaceType>(surface, function);
+    default:
+        return false;
+    }
+}
+
+}// namespace core
+}// namespace adsk
@@ -43,6 +43,14 @@ public:
     /// Returns an evaluator object that lets you perform additional evaluations on the curve.
     Ptr<CurveEvaluator3D> evaluator() const;
 
+    /// Returns an evaluator of a private copy of the curve, which is detached from this curve. Changes
+    /// made to this curve afterwards don't affect the evaluator, and the evaluator shares no state with
+    /// the curve or with other evaluators, so it can be passed to a worker thread and used there while
+    /// this curve is changed or evaluated on other threads. See CurveEvaluator3D for the rules that
+    /// apply when using geometry from more than one thread.
+    /// Returns the evaluator or null if the curve isn't transient, such as the geometry of a B-Rep edge.
+    Ptr<CurveEvaluator3D> detachedEvaluator() const;
+
     /// Transforms this curve in 3D space.
     /// matrix : A 3D matrix that defines the transform to apply to the curve.
     /// Return true if the transform was successful.
@@ -59,7 +67,7 @@ private:
     virtual Curve3DTypes curveType_raw() const = 0;
     virtual CurveEvaluator3D* evaluator_raw() const = 0;
     virtual bool transformBy_raw(Matrix3D* matrix) = 0;
-    virtual void placeholderCurve3D0() {}
+    virtual CurveEvaluator3D* detachedEvaluator_raw() const = 0;
     virtual void placeholderCurve3D1() {}
     virtual void placeholderCurve3D2() {}
     virtual void placeholderCurve3D3() {}
@@ -104,6 +112,12 @@ inline Ptr<CurveEvaluator3D> Curve3D::evaluator() const
     return res;
 }
 
+inline Ptr<CurveEvaluator3D> Curve3D::detachedEvaluator() const
+{
+    Ptr<CurveEvaluator3D> res = detachedEvaluator_raw();
+    return res;
+}
+
 inline bool Curve3D::transformBy(const Ptr<Matrix3D>& matrix)
 {
     bool res = transformBy_raw(matrix.get());
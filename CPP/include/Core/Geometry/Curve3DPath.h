@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -47,6 +48,10 @@ public:
     /// Returns the number of Curve3D objects contained in this Curve3D collection.
     size_t count() const;
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Curve3D>> asArray() const;
+
     typedef Curve3D iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -60,6 +65,7 @@ private:
     // Raw interface
     virtual Curve3D* item_raw(size_t index) const = 0;
     virtual size_t count_raw() const = 0;
+    virtual Curve3D** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -76,9 +82,23 @@ inline size_t Curve3DPath::count() const
     return res;
 }
 
+inline std::vector<Ptr<Curve3D>> Curve3DPath::asArray() const
+{
+    std::vector<Ptr<Curve3D>> res;
+    size_t s;
+
+    Curve3D** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void Curve3DPath::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
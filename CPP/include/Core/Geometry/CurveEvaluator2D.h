@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
@@ -127,6 +128,22 @@ public:
     /// Returns true if the points were successfully returned.
     bool getPointsAtParameters(const std::vector<double>& parameters, std::vector<Ptr<Point2D>>& points) const;
 
+    /// Get the points on the curve that correspond to evaluating a set of parameter positions on the curve,
+    /// returning the coordinates in an array supplied by the caller. When the same array is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// parameters : The array of parameter positions to evaluate the curve position at.
+    /// points : The output array of coordinates. It is resized to 2 values for each parameter, stored as x, y.
+    /// Returns true if the points were successfully returned.
+    bool getPointsAtParameters(const std::vector<double>& parameters, std::vector<double>& points) const;
+
+    /// Get the points on the curve that correspond to evaluating a set of parameter positions on the curve,
+    /// writing the coordinates into a buffer supplied by the caller.
+    /// parameters : The parameter positions to evaluate the curve position at.
+    /// count : The number of parameter positions.
+    /// points : The output buffer, which must have room for 2 * count values. The coordinates are written as x, y for each parameter.
+    /// Returns true if the points were successfully returned.
+    bool getPointsAtParameters(const double* parameters, size_t count, double* points) const;
+
     /// Get the point on the curve that corresponds to evaluating a parameter position on the curve.
     /// parameter : The parameter position to evaluate the curve position at.
     /// The parameter value must be within the range of the parameter extents as provided by getParameterExtents.
@@ -219,6 +236,7 @@ private:
     virtual bool getThirdDerivatives_raw(const double* parameters, size_t parameters_size, Vector2D**& thirdDerivatives, size_t& thirdDerivatives_size) const = 0;
     virtual bool getThirdDerivative_raw(double parameter, Vector2D*& thirdDerivative) const = 0;
     virtual bool getStrokes_raw(double fromParameter, double toParameter, double tolerance, Point2D**& vertexCoordinates, size_t& vertexCoordinates_size) const = 0;
+    virtual bool getPointsAtParametersFlat_raw(const double* parameters, size_t count, double* points) const = 0;
 };
 
 // Inline wrappers
@@ -301,14 +319,13 @@ inline bool CurveEvaluator2D::getParameterAtLength(double fromParameter, double
 
 inline bool CurveEvaluator2D::getParametersAtPoints(const std::vector<Ptr<Point2D>>& points, std::vector<double>& parameters) const
 {
-    Point2D** points_ = new Point2D*[points.size()];
+    ScratchArray<Point2D*> points_(points.size());
     for(size_t i=0; i<points.size(); ++i)
         points_[i] = points[i].get();
     double* parameters_ = nullptr;
     size_t parameters_size;
 
     bool res = getParametersAtPoints_raw(points_, points.size(), parameters_, parameters_size);
-    delete[] points_;
     if(parameters_)
     {
         parameters.assign(parameters_, parameters_ + parameters_size);
@@ -343,6 +360,19 @@ inline bool CurveEvaluator2D::getPointsAtParameters(const std::vector<double>& p
     return res;
 }
 
+inline bool CurveEvaluator2D::getPointsAtParameters(const std::vector<double>& parameters, std::vector<double>& points) const
+{
+    points.resize(parameters.size() * 2);
+    bool res = getPointsAtParametersFlat_raw(parameters.empty() ? nullptr : &parameters[0], parameters.size(), points.empty() ? nullptr : &points[0]);
+    return res;
+}
+
+inline bool CurveEvaluator2D::getPointsAtParameters(const double* parameters, size_t count, double* points) const
+{
+    bool res = getPointsAtParametersFlat_raw(parameters, count, points);
+    return res;
+}
+
 inline bool CurveEvaluator2D::getPointAtParameter(double parameter, Ptr<Point2D>& point) const
 {
     Point2D* point_ = nullptr;
@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
@@ -36,6 +37,17 @@ namespace adsk { namespace core {
 
 /// 3D curve evaluator that is obtained from a transient curve and allows you to perform
 /// various evaluations on the curve.
+///
+/// Transient geometry, which is the Point3D, Vector3D, Matrix3D, curve and surface objects created
+/// by the API and the evaluators obtained from them, can be used from any thread. Reference counting
+/// is atomic, so Ptr objects referring to the same object can be copied and released on different
+/// threads at the same time, although a single Ptr object must not be assigned on one thread while
+/// another thread uses it. Any number of threads can call the const methods of an object at the same
+/// time, but a method that changes an object must not run at the same time as any other use of it.
+/// An evaluator obtained from Curve3D.evaluator refers to its curve, so changing the curve counts as
+/// changing the evaluator; Curve3D.detachedEvaluator returns an evaluator that is independent of the
+/// curve. Geometry obtained from a document, such as the geometry of B-Rep and sketch entities, must
+/// only be used on the main thread.
 class CurveEvaluator3D : public Base {
 public:
 
@@ -112,6 +124,22 @@ public:
     /// Returns true if the points were successfully returned.
     bool getPointsAtParameters(const std::vector<double>& parameters, std::vector<Ptr<Point3D>>& points) const;
 
+    /// Get the points on the curve that correspond to evaluating a set of parameter positions on the curve,
+    /// returning the coordinates in an array supplied by the caller. When the same array is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// parameters : The array of parameter positions to evaluate the curve position at.
+    /// points : The output array of coordinates. It is resized to 3 values for each parameter, stored as x, y, z.
+    /// Returns true if the points were successfully returned.
+    bool getPointsAtParameters(const std::vector<double>& parameters, std::vector<double>& points) const;
+
+    /// Get the points on the curve that correspond to evaluating a set of parameter positions on the curve,
+    /// writing the coordinates into a buffer supplied by the caller.
+    /// parameters : The parameter positions to evaluate the curve position at.
+    /// count : The number of parameter positions.
+    /// points : The output buffer, which must have room for 3 * count values. The coordinates are written as x, y, z for each parameter.
+    /// Returns true if the points were successfully returned.
+    bool getPointsAtParameters(const double* parameters, size_t count, double* points) const;
+
     /// Get the point on the curve that corresponds to evaluating a parameter position on the curve.
     /// parameter : The parameter position to evaluate the curve position at.
     /// The parameter value must be within the range of the parameter extents as provided by getParameterExtents.
@@ -219,6 +247,7 @@ private:
     virtual bool getStrokes_raw(double fromParameter, double toParameter, double tolerance, Point3D**& vertexCoordinates, size_t& vertexCoordinates_size) const = 0;
     virtual bool getTangents_raw(const double* parameters, size_t parameters_size, Vector3D**& tangents, size_t& tangents_size) const = 0;
     virtual bool getTangent_raw(double parameter, Vector3D*& tangent) const = 0;
+    virtual bool getPointsAtParametersFlat_raw(const double* parameters, size_t count, double* points) const = 0;
 };
 
 // Inline wrappers
@@ -278,14 +307,13 @@ inline bool CurveEvaluator3D::getParameterAtLength(double fromParameter, double
 
 inline bool CurveEvaluator3D::getParametersAtPoints(const std::vector<Ptr<Point3D>>& points, std::vector<double>& parameters) const
 {
-    Point3D** points_ = new Point3D*[points.size()];
+    ScratchArray<Point3D*> points_(points.size());
     for(size_t i=0; i<points.size(); ++i)
         points_[i] = points[i].get();
     double* parameters_ = nullptr;
     size_t parameters_size;
 
     bool res = getParametersAtPoints_raw(points_, points.size(), parameters_, parameters_size);
-    delete[] points_;
     if(parameters_)
     {
         parameters.assign(parameters_, parameters_ + parameters_size);
@@ -320,6 +348,19 @@ inline bool CurveEvaluator3D::getPointsAtParameters(const std::vector<double>& p
     return res;
 }
 
+inline bool CurveEvaluator3D::getPointsAtParameters(const std::vector<double>& parameters, std::vector<double>& points) const
+{
+    points.resize(parameters.size() * 3);
+    bool res = getPointsAtParametersFlat_raw(parameters.empty() ? nullptr : &parameters[0], parameters.size(), points.empty() ? nullptr : &points[0]);
+    return res;
+}
+
+inline bool CurveEvaluator3D::getPointsAtParameters(const double* parameters, size_t count, double* points) const
+{
+    bool res = getPointsAtParametersFlat_raw(parameters, count, points);
+    return res;
+}
+
 inline bool CurveEvaluator3D::getPointAtParameter(double parameter, Ptr<Point3D>& point) const
 {
     Point3D* point_ = nullptr;
@@ -88,6 +88,11 @@ public:
     /// Returns the array of matrix values.
     std::vector<double> asArray() const;
 
+    /// Gets the cells of the matrix without allocating an array.
+    /// cells : The output buffer, which must have room for 9 values. The values are written in the same order as returned by asArray.
+    /// Returns true if the values were successfully returned.
+    bool getAsArray(double* cells) const;
+
     /// Reset this matrix to align with a specific coordinate system.
     /// origin : The origin point of the coordinate system.
     /// xAxis : The x axis direction of the coordinate system.
@@ -151,6 +156,7 @@ private:
     virtual bool setToAlignCoordinateSystems_raw(Point2D* fromOrigin, Vector2D* fromXAxis, Vector2D* fromYAxis, Point2D* toOrigin, Vector2D* toXAxis, Vector2D* toYAxis) = 0;
     virtual bool setToRotateTo_raw(Vector2D* from, Vector2D* to) = 0;
     virtual bool setToRotation_raw(double angle, Point2D* origin) = 0;
+    virtual bool getAsArray_raw(double* cells) const = 0;
 };
 
 // Inline wrappers
@@ -229,6 +235,12 @@ inline std::vector<double> Matrix2D::asArray() const
     return res;
 }
 
+inline bool Matrix2D::getAsArray(double* cells) const
+{
+    bool res = getAsArray_raw(cells);
+    return res;
+}
+
 inline bool Matrix2D::setWithCoordinateSystem(const Ptr<Point2D>& origin, const Ptr<Vector2D>& xAxis, const Ptr<Vector2D>& yAxis)
 {
     bool res = setWithCoordinateSystem_raw(origin.get(), xAxis.get(), yAxis.get());
@@ -37,6 +37,7 @@ namespace adsk { namespace core {
 /// Transient 3D 4x4 matrix. This object is a wrapper over 3D matrix data and is used as way to pass matrix data
 /// in and out of the API and as a convenience when operating on matrix data.
 /// They are created statically using the create method of the Matrix3D class.
+/// Matrices can be used from worker threads as described for CurveEvaluator3D.
 class Matrix3D : public Base {
 public:
 
@@ -97,6 +98,11 @@ public:
     /// Returns the array of cell values.
     std::vector<double> asArray() const;
 
+    /// Gets the cells of the matrix without allocating an array.
+    /// cells : The output buffer, which must have room for 16 values. The values are written in the same order as returned by asArray.
+    /// Returns true if the values were successfully returned.
+    bool getAsArray(double* cells) const;
+
     /// Sets the contents of the array using a 16 element array.
     /// cells : The array of cell values.
     /// Returns true if successful.
@@ -165,6 +171,7 @@ private:
     virtual bool setToAlignCoordinateSystems_raw(Point3D* fromOrigin, Vector3D* fromXAxis, Vector3D* fromYAxis, Vector3D* fromZAxis, Point3D* toOrigin, Vector3D* toXAxis, Vector3D* toYAxis, Vector3D* toZAxis) = 0;
     virtual bool setToRotateTo_raw(Vector3D* from, Vector3D* to, Vector3D* axis) = 0;
     virtual bool setToRotation_raw(double angle, Vector3D* axis, Point3D* origin) = 0;
+    virtual bool getAsArray_raw(double* cells) const = 0;
 };
 
 // Inline wrappers
@@ -251,6 +258,12 @@ inline std::vector<double> Matrix3D::asArray() const
     return res;
 }
 
+inline bool Matrix3D::getAsArray(double* cells) const
+{
+    bool res = getAsArray_raw(cells);
+    return res;
+}
+
 inline bool Matrix3D::setWithArray(const std::vector<double>& cells)
 {
     bool res = setWithArray_raw(cells.empty() ? nullptr : &cells[0], cells.size());
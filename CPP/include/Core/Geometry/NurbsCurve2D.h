@@ -10,6 +10,7 @@
 
 #pragma once
 #include "Curve2D.h"
+#include "../ScratchArena.h"
 #include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
@@ -82,9 +83,39 @@ public:
     /// Returns an array of Point2D objects that define the control points of the curve.
     std::vector<Ptr<Point2D>> controlPoints() const;
 
+    /// Gets the coordinates of the control points of the curve, returning the values in an array supplied by the caller. When the same array is
+    /// passed to repeated calls, its storage is reused and no memory is allocated once it is large enough.
+    /// coordinates : The output array of coordinates, 2 values for each control point stored as x, y. It is resized to the number of values returned.
+    /// Returns true if the values were successfully returned.
+    bool getControlPoints(std::vector<double>& coordinates) const;
+
+    /// Gets the coordinates of the control points of the curve, writing the values into a buffer supplied by the caller.
+    /// coordinates : The output buffer of coordinates, 2 values for each control point stored as x, y. Nothing is written if the buffer is too small.
+    /// capacity : The number of values the buffer can hold.
+    /// count : The output number of values, which is 2 times the number of control points. This is returned even when the buffer
+    /// is too small, so the call can be repeated with a buffer of the required size.
+    /// Returns true if the values were successfully returned or the buffer was too small. Compare count with
+    /// capacity to know if the values were written.
+    bool getControlPoints(double* coordinates, size_t capacity, size_t& count) const;
+
     /// Returns an array of numbers that define the Knots of the curve.
     std::vector<double> knots() const;
 
+    /// Gets the knot vector of the curve, returning the values in an array supplied by the caller. When the same array is
+    /// passed to repeated calls, its storage is reused and no memory is allocated once it is large enough.
+    /// knots : The output array of knots. It is resized to the number of values returned.
+    /// Returns true if the values were successfully returned.
+    bool getKnots(std::vector<double>& knots) const;
+
+    /// Gets the knot vector of the curve, writing the values into a buffer supplied by the caller.
+    /// knots : The output buffer of knots. Nothing is written if the buffer is too small.
+    /// capacity : The number of values the buffer can hold.
+    /// count : The output number of values. This is returned even when the buffer
+    /// is too small, so the call can be repeated with a buffer of the required size.
+    /// Returns true if the values were successfully returned or the buffer was too small. Compare count with
+    /// capacity to know if the values were written.
+    bool getKnots(double* knots, size_t capacity, size_t& count) const;
+
     /// Gets the data that defines a transient 2D NURBS rational b-spline object.
     /// controlPoints : The output array of control point that define the path of the spline.
     /// degree : The output degree of curvature of the spline.
@@ -156,29 +187,29 @@ private:
     virtual NurbsCurve2D* extract_raw(double startParam, double endParam) const = 0;
     virtual NurbsCurve2D* merge_raw(NurbsCurve2D* nurbsCurve) const = 0;
     virtual bool reverse_raw() = 0;
+    virtual bool getControlPoints_raw(double* coordinates, size_t capacity, size_t& count) const = 0;
+    virtual bool getKnots_raw(double* knots, size_t capacity, size_t& count) const = 0;
 };
 
 // Inline wrappers
 
 inline Ptr<NurbsCurve2D> NurbsCurve2D::createNonRational(const std::vector<Ptr<Point2D>>& controlPoints, int degree, const std::vector<double>& knots, bool isPeriodic)
 {
-    Point2D** controlPoints_ = new Point2D*[controlPoints.size()];
+    ScratchArray<Point2D*> controlPoints_(controlPoints.size());
     for(size_t i=0; i<controlPoints.size(); ++i)
         controlPoints_[i] = controlPoints[i].get();
 
     Ptr<NurbsCurve2D> res = createNonRational_raw(controlPoints_, controlPoints.size(), degree, knots.empty() ? nullptr : &knots[0], knots.size(), isPeriodic);
-    delete[] controlPoints_;
     return res;
 }
 
 inline Ptr<NurbsCurve2D> NurbsCurve2D::createRational(const std::vector<Ptr<Point2D>>& controlPoints, int degree, const std::vector<double>& knots, const std::vector<double>& weights, bool isPeriodic)
 {
-    Point2D** controlPoints_ = new Point2D*[controlPoints.size()];
+    ScratchArray<Point2D*> controlPoints_(controlPoints.size());
     for(size_t i=0; i<controlPoints.size(); ++i)
         controlPoints_[i] = controlPoints[i].get();
 
     Ptr<NurbsCurve2D> res = createRational_raw(controlPoints_, controlPoints.size(), degree, knots.empty() ? nullptr : &knots[0], knots.size(), weights.empty() ? nullptr : &weights[0], weights.size(), isPeriodic);
-    delete[] controlPoints_;
     return res;
 }
 
@@ -238,6 +269,26 @@ inline std::vector<Ptr<Point2D>> NurbsCurve2D::controlPoints() const
     return res;
 }
 
+inline bool NurbsCurve2D::getControlPoints(std::vector<double>& coordinates) const
+{
+    size_t count = 0;
+    coordinates.resize(coordinates.capacity());
+    bool res = getControlPoints_raw(coordinates.empty() ? nullptr : &coordinates[0], coordinates.size(), count);
+    if(res && count > coordinates.size())
+    {
+        coordinates.resize(count);
+        res = getControlPoints_raw(&coordinates[0], coordinates.size(), count);
+    }
+    coordinates.resize(res ? count : 0);
+    return res;
+}
+
+inline bool NurbsCurve2D::getControlPoints(double* coordinates, size_t capacity, size_t& count) const
+{
+    bool res = getControlPoints_raw(coordinates, capacity, count);
+    return res;
+}
+
 inline std::vector<double> NurbsCurve2D::knots() const
 {
     std::vector<double> res;
@@ -252,6 +303,26 @@ inline std::vector<double> NurbsCurve2D::knots() const
     return res;
 }
 
+inline bool NurbsCurve2D::getKnots(std::vector<double>& knots) const
+{
+    size_t count = 0;
+    knots.resize(knots.capacity());
+    bool res = getKnots_raw(knots.empty() ? nullptr : &knots[0], knots.size(), count);
+    if(res && count > knots.size())
+    {
+        knots.resize(count);
+        res = getKnots_raw(&knots[0], knots.size(), count);
+    }
+    knots.resize(res ? count : 0);
+    return res;
+}
+
+inline bool NurbsCurve2D::getKnots(double* knots, size_t capacity, size_t& count) const
+{
+    bool res = getKnots_raw(knots, capacity, count);
+    return res;
+}
+
 inline bool NurbsCurve2D::getData(std::vector<Ptr<Point2D>>& controlPoints, int& degree, std::vector<double>& knots, bool& isRational, std::vector<double>& weights, bool& isPeriodic) const
 {
     Point2D** controlPoints_ = nullptr;
@@ -282,12 +353,11 @@ inline bool NurbsCurve2D::getData(std::vector<Ptr<Point2D>>& controlPoints, int&
 
 inline bool NurbsCurve2D::set(const std::vector<Ptr<Point2D>>& controlPoints, int degree, const std::vector<double>& knots, bool isRational, const std::vector<double>& weights, bool isPeriodic)
 {
-    Point2D** controlPoints_ = new Point2D*[controlPoints.size()];
+    ScratchArray<Point2D*> controlPoints_(controlPoints.size());
     for(size_t i=0; i<controlPoints.size(); ++i)
         controlPoints_[i] = controlPoints[i].get();
 
     bool res = set_raw(controlPoints_, controlPoints.size(), degree, knots.empty() ? nullptr : &knots[0], knots.size(), isRational, weights.empty() ? nullptr : &weights[0], weights.size(), isPeriodic);
-    delete[] controlPoints_;
     return res;
 }
 
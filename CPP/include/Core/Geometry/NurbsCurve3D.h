@@ -10,6 +10,7 @@
 
 #pragma once
 #include "Curve3D.h"
+#include "../ScratchArena.h"
 #include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
@@ -35,6 +36,8 @@ namespace adsk { namespace core {
 /// Transient 3D NURBS curve. A transient NURBS curve is not displayed or saved in a document.
 /// Transient 3D NURBS curves are used as a wrapper to work with raw 3D NURBS curve information.
 /// They are created statically using one of the create methods of the NurbsCurve3D class.
+/// Transient curves can be used from worker threads as described for CurveEvaluator3D; use
+/// detachedEvaluator to evaluate a curve on a worker thread while it is being changed elsewhere.
 class NurbsCurve3D : public Curve3D {
 public:
 
@@ -78,9 +81,39 @@ public:
     /// Returns an array of Point3D objects that define the control points of the curve.
     std::vector<Ptr<Point3D>> controlPoints() const;
 
+    /// Gets the coordinates of the control points of the curve, returning the values in an array supplied by the caller. When the same array is
+    /// passed to repeated calls, its storage is reused and no memory is allocated once it is large enough.
+    /// coordinates : The output array of coordinates, 3 values for each control point stored as x, y, z. It is resized to the number of values returned.
+    /// Returns true if the values were successfully returned.
+    bool getControlPoints(std::vector<double>& coordinates) const;
+
+    /// Gets the coordinates of the control points of the curve, writing the values into a buffer supplied by the caller.
+    /// coordinates : The output buffer of coordinates, 3 values for each control point stored as x, y, z. Nothing is written if the buffer is too small.
+    /// capacity : The number of values the buffer can hold.
+    /// count : The output number of values, which is 3 times the number of control points. This is returned even when the buffer
+    /// is too small, so the call can be repeated with a buffer of the required size.
+    /// Returns true if the values were successfully returned or the buffer was too small. Compare count with
+    /// capacity to know if the values were written.
+    bool getControlPoints(double* coordinates, size_t capacity, size_t& count) const;
+
     /// Returns an array of numbers that define the knot vector of the curve.
     std::vector<double> knots() const;
 
+    /// Gets the knot vector of the curve, returning the values in an array supplied by the caller. When the same array is
+    /// passed to repeated calls, its storage is reused and no memory is allocated once it is large enough.
+    /// knots : The output array of knots. It is resized to the number of values returned.
+    /// Returns true if the values were successfully returned.
+    bool getKnots(std::vector<double>& knots) const;
+
+    /// Gets the knot vector of the curve, writing the values into a buffer supplied by the caller.
+    /// knots : The output buffer of knots. Nothing is written if the buffer is too small.
+    /// capacity : The number of values the buffer can hold.
+    /// count : The output number of values. This is returned even when the buffer
+    /// is too small, so the call can be repeated with a buffer of the required size.
+    /// Returns true if the values were successfully returned or the buffer was too small. Compare count with
+    /// capacity to know if the values were written.
+    bool getKnots(double* knots, size_t capacity, size_t& count) const;
+
     /// Gets the data that defines a transient 3D NURBS rational b-spline object.
     /// controlPoints : The output array of control point that define the path of the spline.
     /// degree : The output degree of curvature of the spline.
@@ -153,29 +186,29 @@ private:
     virtual NurbsCurve3D* merge_raw(NurbsCurve3D* nurbsCurve) const = 0;
     virtual NurbsCurve3D* copy_raw() const = 0;
     virtual bool reverse_raw() = 0;
+    virtual bool getControlPoints_raw(double* coordinates, size_t capacity, size_t& count) const = 0;
+    virtual bool getKnots_raw(double* knots, size_t capacity, size_t& count) const = 0;
 };
 
 // Inline wrappers
 
 inline Ptr<NurbsCurve3D> NurbsCurve3D::createNonRational(const std::vector<Ptr<Point3D>>& controlPoints, int degree, const std::vector<double>& knots, bool isPeriodic)
 {
-    Point3D** controlPoints_ = new Point3D*[controlPoints.size()];
+    ScratchArray<Point3D*> controlPoints_(controlPoints.size());
     for(size_t i=0; i<controlPoints.size(); ++i)
         controlPoints_[i] = controlPoints[i].get();
 
     Ptr<NurbsCurve3D> res = createNonRational_raw(controlPoints_, controlPoints.size(), degree, knots.empty() ? nullptr : &knots[0], knots.size(), isPeriodic);
-    delete[] controlPoints_;
     return res;
 }
 
 inline Ptr<NurbsCurve3D> NurbsCurve3D::createRational(const std::vector<Ptr<Point3D>>& controlPoints, int degree, const std::vector<double>& knots, const std::vector<double>& weights, bool isPeriodic)
 {
-    Point3D** controlPoints_ = new Point3D*[controlPoints.size()];
+    ScratchArray<Point3D*> controlPoints_(controlPoints.size());
     for(size_t i=0; i<controlPoints.size(); ++i)
         controlPoints_[i] = controlPoints[i].get();
 
     Ptr<NurbsCurve3D> res = createRational_raw(controlPoints_, controlPoints.size(), degree, knots.empty() ? nullptr : &knots[0], knots.size(), weights.empty() ? nullptr : &weights[0], weights.size(), isPeriodic);
-    delete[] controlPoints_;
     return res;
 }
 
@@ -229,6 +262,26 @@ inline std::vector<Ptr<Point3D>> NurbsCurve3D::controlPoints() const
     return res;
 }
 
+inline bool NurbsCurve3D::getControlPoints(std::vector<double>& coordinates) const
+{
+    size_t count = 0;
+    coordinates.resize(coordinates.capacity());
+    bool res = getControlPoints_raw(coordinates.empty() ? nullptr : &coordinates[0], coordinates.size(), count);
+    if(res && count > coordinates.size())
+    {
+        coordinates.resize(count);
+        res = getControlPoints_raw(&coordinates[0], coordinates.size(), count);
+    }
+    coordinates.resize(res ? count : 0);
+    return res;
+}
+
+inline bool NurbsCurve3D::getControlPoints(double* coordinates, size_t capacity, size_t& count) const
+{
+    bool res = getControlPoints_raw(coordinates, capacity, count);
+    return res;
+}
+
 inline std::vector<double> NurbsCurve3D::knots() const
 {
     std::vector<double> res;
@@ -243,6 +296,26 @@ inline std::vector<double> NurbsCurve3D::knots() const
     return res;
 }
 
+inline bool NurbsCurve3D::getKnots(std::vector<double>& knots) const
+{
+    size_t count = 0;
+    knots.resize(knots.capacity());
+    bool res = getKnots_raw(knots.empty() ? nullptr : &knots[0], knots.size(), count);
+    if(res && count > knots.size())
+    {
+        knots.resize(count);
+        res = getKnots_raw(&knots[0], knots.size(), count);
+    }
+    knots.resize(res ? count : 0);
+    return res;
+}
+
+inline bool NurbsCurve3D::getKnots(double* knots, size_t capacity, size_t& count) const
+{
+    bool res = getKnots_raw(knots, capacity, count);
+    return res;
+}
+
 inline bool NurbsCurve3D::getData(std::vector<Ptr<Point3D>>& controlPoints, int& degree, std::vector<double>& knots, bool& isRational, std::vector<double>& weights, bool& isPeriodic) const
 {
     Point3D** controlPoints_ = nullptr;
@@ -273,12 +346,11 @@ inline bool NurbsCurve3D::getData(std::vector<Ptr<Point3D>>& controlPoints, int&
 
 inline bool NurbsCurve3D::set(const std::vector<Ptr<Point3D>>& controlPoints, int degree, const std::vector<double>& knots, bool isRational, const std::vector<double>& weights, bool isPeriodic)
 {
-    Point3D** controlPoints_ = new Point3D*[controlPoints.size()];
+    ScratchArray<Point3D*> controlPoints_(controlPoints.size());
     for(size_t i=0; i<controlPoints.size(); ++i)
         controlPoints_[i] = controlPoints[i].get();
 
     bool res = set_raw(controlPoints_, controlPoints.size(), degree, knots.empty() ? nullptr : &knots[0], knots.size(), isRational, weights.empty() ? nullptr : &weights[0], weights.size(), isPeriodic);
-    delete[] controlPoints_;
     return res;
 }
 
@@ -11,6 +11,7 @@
 #pragma once
 #include "Surface.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
@@ -84,12 +85,57 @@ public:
     /// Gets an array of control points from the surface.
     std::vector<Ptr<Point3D>> controlPoints() const;
 
+    /// Gets the coordinates of the control points of the surface, returning the values in an array supplied by the caller. When the same array is
+    /// passed to repeated calls, its storage is reused and no memory is allocated once it is large enough.
+    /// coordinates : The output array of coordinates, 3 values for each control point stored as x, y, z in the same order as controlPoints. It is resized to the number of values returned.
+    /// Returns true if the values were successfully returned.
+    bool getControlPoints(std::vector<double>& coordinates) const;
+
+    /// Gets the coordinates of the control points of the surface, writing the values into a buffer supplied by the caller.
+    /// coordinates : The output buffer of coordinates, 3 values for each control point stored as x, y, z in the same order as controlPoints. Nothing is written if the buffer is too small.
+    /// capacity : The number of values the buffer can hold.
+    /// count : The output number of values, which is 3 times the number of control points. This is returned even when the buffer
+    /// is too small, so the call can be repeated with a buffer of the required size.
+    /// Returns true if the values were successfully returned or the buffer was too small. Compare count with
+    /// capacity to know if the values were written.
+    bool getControlPoints(double* coordinates, size_t capacity, size_t& count) const;
+
     /// Get the knot vector from the U direction.
     std::vector<double> knotsU() const;
 
+    /// Gets the knot vector in the U direction, returning the values in an array supplied by the caller. When the same array is
+    /// passed to repeated calls, its storage is reused and no memory is allocated once it is large enough.
+    /// knots : The output array of knots. It is resized to the number of values returned.
+    /// Returns true if the values were successfully returned.
+    bool getKnotsU(std::vector<double>& knots) const;
+
+    /// Gets the knot vector in the U direction, writing the values into a buffer supplied by the caller.
+    /// knots : The output buffer of knots. Nothing is written if the buffer is too small.
+    /// capacity : The number of values the buffer can hold.
+    /// count : The output number of values. This is returned even when the buffer
+    /// is too small, so the call can be repeated with a buffer of the required size.
+    /// Returns true if the values were successfully returned or the buffer was too small. Compare count with
+    /// capacity to know if the values were written.
+    bool getKnotsU(double* knots, size_t capacity, size_t& count) const;
+
     /// Get the knot vector from the V direction
     std::vector<double> knotsV() const;
 
+    /// Gets the knot vector in the V direction, returning the values in an array supplied by the caller. When the same array is
+    /// passed to repeated calls, its storage is reused and no memory is allocated once it is large enough.
+    /// knots : The output array of knots. It is resized to the number of values returned.
+    /// Returns true if the values were successfully returned.
+    bool getKnotsV(std::vector<double>& knots) const;
+
+    /// Gets the knot vector in the V direction, writing the values into a buffer supplied by the caller.
+    /// knots : The output buffer of knots. Nothing is written if the buffer is too small.
+    /// capacity : The number of values the buffer can hold.
+    /// count : The output number of values. This is returned even when the buffer
+    /// is too small, so the call can be repeated with a buffer of the required size.
+    /// Returns true if the values were successfully returned or the buffer was too small. Compare count with
+    /// capacity to know if the values were written.
+    bool getKnotsV(double* knots, size_t capacity, size_t& count) const;
+
     /// Gets the data that defines the NURBS surface.
     /// degreeU : The output degree in the U direction.
     /// degreeV : The output degree in the V direction.
@@ -145,18 +191,20 @@ private:
     virtual bool getData_raw(int& degreeU, int& degreeV, int& controlPointCountU, int& controlPointCountV, Point3D**& controlPoints, size_t& controlPoints_size, double*& knotsU, size_t& knotsU_size, double*& knotsV, size_t& knotsV_size, double*& weights, size_t& weights_size, NurbsSurfaceProperties& propertiesU, NurbsSurfaceProperties& propertiesV) const = 0;
     virtual bool set_raw(int degreeU, int degreeV, int controlPointCountU, int controlPointCountV, Point3D** controlPoints, size_t controlPoints_size, const double* knotsU, size_t knotsU_size, const double* knotsV, size_t knotsV_size, const double* weights, size_t weights_size, NurbsSurfaceProperties propertiesU, NurbsSurfaceProperties propertiesV) = 0;
     virtual NurbsSurface* copy_raw() const = 0;
+    virtual bool getControlPoints_raw(double* coordinates, size_t capacity, size_t& count) const = 0;
+    virtual bool getKnotsU_raw(double* knots, size_t capacity, size_t& count) const = 0;
+    virtual bool getKnotsV_raw(double* knots, size_t capacity, size_t& count) const = 0;
 };
 
 // Inline wrappers
 
 inline Ptr<NurbsSurface> NurbsSurface::create(int degreeU, int degreeV, int controlPointCountU, int controlPointCountV, const std::vector<Ptr<Point3D>>& controlPoints, const std::vector<double>& knotsU, const std::vector<double>& knotsV, const std::vector<double>& weights, NurbsSurfaceProperties propertiesU, NurbsSurfaceProperties propertiesV)
 {
-    Point3D** controlPoints_ = new Point3D*[controlPoints.size()];
+    ScratchArray<Point3D*> controlPoints_(controlPoints.size());
     for(size_t i=0; i<controlPoints.size(); ++i)
         controlPoints_[i] = controlPoints[i].get();
 
     Ptr<NurbsSurface> res = create_raw(degreeU, degreeV, controlPointCountU, controlPointCountV, controlPoints_, controlPoints.size(), knotsU.empty() ? nullptr : &knotsU[0], knotsU.size(), knotsV.empty() ? nullptr : &knotsV[0], knotsV.size(), weights.empty() ? nullptr : &weights[0], weights.size(), propertiesU, propertiesV);
-    delete[] controlPoints_;
     return res;
 }
 
@@ -222,6 +270,26 @@ inline std::vector<Ptr<Point3D>> NurbsSurface::controlPoints() const
     return res;
 }
 
+inline bool NurbsSurface::getControlPoints(std::vector<double>& coordinates) const
+{
+    size_t count = 0;
+    coordinates.resize(coordinates.capacity());
+    bool res = getControlPoints_raw(coordinates.empty() ? nullptr : &coordinates[0], coordinates.size(), count);
+    if(res && count > coordinates.size())
+    {
+        coordinates.resize(count);
+        res = getControlPoints_raw(&coordinates[0], coordinates.size(), count);
+    }
+    coordinates.resize(res ? count : 0);
+    return res;
+}
+
+inline bool NurbsSurface::getControlPoints(double* coordinates, size_t capacity, size_t& count) const
+{
+    bool res = getControlPoints_raw(coordinates, capacity, count);
+    return res;
+}
+
 inline std::vector<double> NurbsSurface::knotsU() const
 {
     std::vector<double> res;
@@ -236,6 +304,26 @@ inline std::vector<double> NurbsSurface::knotsU() const
     return res;
 }
 
+inline bool NurbsSurface::getKnotsU(std::vector<double>& knots) const
+{
+    size_t count = 0;
+    knots.resize(knots.capacity());
+    bool res = getKnotsU_raw(knots.empty() ? nullptr : &knots[0], knots.size(), count);
+    if(res && count > knots.size())
+    {
+        knots.resize(count);
+        res = getKnotsU_raw(&knots[0], knots.size(), count);
+    }
+    knots.resize(res ? count : 0);
+    return res;
+}
+
+inline bool NurbsSurface::getKnotsU(double* knots, size_t capacity, size_t& count) const
+{
+    bool res = getKnotsU_raw(knots, capacity, count);
+    return res;
+}
+
 inline std::vector<double> NurbsSurface::knotsV() const
 {
     std::vector<double> res;
@@ -250,6 +338,26 @@ inline std::vector<double> NurbsSurface::knotsV() const
     return res;
 }
 
+inline bool NurbsSurface::getKnotsV(std::vector<double>& knots) const
+{
+    size_t count = 0;
+    knots.resize(knots.capacity());
+    bool res = getKnotsV_raw(knots.empty() ? nullptr : &knots[0], knots.size(), count);
+    if(res && count > knots.size())
+    {
+        knots.resize(count);
+        res = getKnotsV_raw(&knots[0], knots.size(), count);
+    }
+    knots.resize(res ? count : 0);
+    return res;
+}
+
+inline bool NurbsSurface::getKnotsV(double* knots, size_t capacity, size_t& count) const
+{
+    bool res = getKnotsV_raw(knots, capacity, count);
+    return res;
+}
+
 inline bool NurbsSurface::getData(int& degreeU, int& degreeV, int& controlPointCountU, int& controlPointCountV, std::vector<Ptr<Point3D>>& controlPoints, std::vector<double>& knotsU, std::vector<double>& knotsV, std::vector<double>& weights, NurbsSurfaceProperties& propertiesU, NurbsSurfaceProperties& propertiesV) const
 {
     Point3D** controlPoints_ = nullptr;
@@ -287,12 +395,11 @@ inline bool NurbsSurface::getData(int& degreeU, int& degreeV, int& controlPointC
 
 inline bool NurbsSurface::set(int degreeU, int degreeV, int controlPointCountU, int controlPointCountV, const std::vector<Ptr<Point3D>>& controlPoints, const std::vector<double>& knotsU, const std::vector<double>& knotsV, const std::vector<double>& weights, NurbsSurfaceProperties propertiesU, NurbsSurfaceProperties propertiesV)
 {
-    Point3D** controlPoints_ = new Point3D*[controlPoints.size()];
+    ScratchArray<Point3D*> controlPoints_(controlPoints.size());
     for(size_t i=0; i<controlPoints.size(); ++i)
         controlPoints_[i] = controlPoints[i].get();
 
     bool res = set_raw(degreeU, degreeV, controlPointCountU, controlPointCountV, controlPoints_, controlPoints.size(), knotsU.empty() ? nullptr : &knotsU[0], knotsU.size(), knotsV.empty() ? nullptr : &knotsV[0], knotsV.size(), weights.empty() ? nullptr : &weights[0], weights.size(), propertiesU, propertiesV);
-    delete[] controlPoints_;
     return res;
 }
 
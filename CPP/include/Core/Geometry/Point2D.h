@@ -73,6 +73,11 @@ public:
     /// Returns the coordinate data of the point as an array
     std::vector<double> asArray() const;
 
+    /// Gets the coordinates of the point without allocating an array.
+    /// coordinates : The output buffer, which must have room for 2 values. The values are written in the same order as returned by asArray.
+    /// Returns true if the values were successfully returned.
+    bool getAsArray(double* coordinates) const;
+
     /// Checks to see if this point and another point are equal (have identical coordinates).
     /// The comparison is done within the modeling tolerance which can be found with the
     /// Application.pointTolerance property. If you want to compare two points with any other
@@ -142,6 +147,7 @@ private:
     virtual bool translateBy_raw(Vector2D* vector) = 0;
     virtual Vector2D* vectorTo_raw(Point2D* point) const = 0;
     virtual bool isEqualToByTolerance_raw(Point2D* point, double tolerance) const = 0;
+    virtual bool getAsArray_raw(double* coordinates) const = 0;
 };
 
 // Inline wrappers
@@ -206,6 +212,12 @@ inline std::vector<double> Point2D::asArray() const
     return res;
 }
 
+inline bool Point2D::getAsArray(double* coordinates) const
+{
+    bool res = getAsArray_raw(coordinates);
+    return res;
+}
+
 inline bool Point2D::isEqualTo(const Ptr<Point2D>& point) const
 {
     bool res = isEqualTo_raw(point.get());
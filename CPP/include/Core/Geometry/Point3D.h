@@ -37,6 +37,7 @@ namespace adsk { namespace core {
 /// Transient 3D point. A transient point is not displayed or saved in a document.
 /// Transient 3D points are used as a wrapper to work with raw 3D point information.
 /// They are created statically using the create method of the Point3D class.
+/// Points can be used from worker threads as described for CurveEvaluator3D.
 class Point3D : public Base {
 public:
 
@@ -60,6 +61,11 @@ public:
     /// Returns the coordinate data of the point as an array [x, y, z].
     std::vector<double> asArray() const;
 
+    /// Gets the coordinates of the point without allocating an array.
+    /// coordinates : The output buffer, which must have room for 3 values. The values are written in the same order as returned by asArray.
+    /// Returns true if the values were successfully returned.
+    bool getAsArray(double* coordinates) const;
+
     /// Checks to see if this point and another point are equal (have identical coordinates).
     /// The comparison is done within the modeling tolerance which can be found with the
     /// Application.pointTolerance property. If you want to compare two points with any other
@@ -151,6 +157,7 @@ private:
     virtual bool set_raw(double x, double y, double z) = 0;
     virtual Vector3D* vectorTo_raw(Point3D* point) const = 0;
     virtual bool isEqualToByTolerance_raw(Point3D* point, double tolerance) const = 0;
+    virtual bool getAsArray_raw(double* coordinates) const = 0;
 };
 
 // Inline wrappers
@@ -187,6 +194,12 @@ inline std::vector<double> Point3D::asArray() const
     return res;
 }
 
+inline bool Point3D::getAsArray(double* coordinates) const
+{
+    bool res = getAsArray_raw(coordinates);
+    return res;
+}
+
 inline bool Point3D::isEqualTo(const Ptr<Point3D>& point) const
 {
     bool res = isEqualTo_raw(point.get());
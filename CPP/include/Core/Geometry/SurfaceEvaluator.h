@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
@@ -30,6 +31,7 @@
 namespace adsk { namespace core {
     class BoundingBox2D;
     class Curve2D;
+    class Curve3D;
     class ObjectCollection;
     class Point2D;
     class Point3D;
@@ -40,6 +42,10 @@ namespace adsk { namespace core {
 
 /// Surface evaluator that is obtained from a transient surface and allows you to perform
 /// various evaluations on the surface.
+///
+/// Evaluators of transient surfaces can be used from worker threads as described for
+/// CurveEvaluator3D. An evaluator refers to its surface, so to evaluate a surface on a worker thread
+/// while it is being changed elsewhere, evaluate a copy of the surface.
 class SurfaceEvaluator : public Base {
 public:
 
@@ -122,6 +128,22 @@ public:
     /// Returns true if the normals were successfully returned.
     bool getNormalsAtPoints(const std::vector<Ptr<Point3D>>& points, std::vector<Ptr<Vector3D>>& normals) const;
 
+    /// Gets the normals at a set of points on the surface, returning the components in an array supplied by the
+    /// caller. When the same array is passed to repeated calls, its storage is reused and no memory is allocated
+    /// once it is large enough.
+    /// points : The array of points to get the normal at, stored as x, y, z for each point.
+    /// normals : The output array of normals. It is resized to 3 values for each point, stored as x, y, z.
+    /// Returns true if the normals were successfully returned. Returns false and clears normals if the size of
+    /// points isn't a multiple of 3.
+    bool getNormalsAtPoints(const std::vector<double>& points, std::vector<double>& normals) const;
+
+    /// Gets the normals at a set of points on the surface, writing the components into a buffer supplied by the caller.
+    /// points : The points to get the normal at, stored as x, y, z for each point.
+    /// count : The number of points.
+    /// normals : The output buffer, which must have room for 3 * count values. The components are written as x, y, z for each point.
+    /// Returns true if the normals were successfully returned.
+    bool getNormalsAtPoints(const double* points, size_t count, double* normals) const;
+
     /// Gets the surface normal at a point on the surface.
     /// point : The point to return the normal at.
     /// For reliable results the point should lie on the surface.
@@ -154,6 +176,23 @@ public:
     /// Returns true if the points were successfully returned.
     bool getPointsAtParameters(const std::vector<Ptr<Point2D>>& parameters, std::vector<Ptr<Point3D>>& points) const;
 
+    /// Get the points on the surface that correspond to evaluating a set of parameter positions on the surface,
+    /// returning the coordinates in an array supplied by the caller. When the same array is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// parameters : The array of parameter positions to evaluate the surface position at, stored as u, v for each position.
+    /// points : The output array of coordinates. It is resized to 3 values for each parameter position, stored as x, y, z.
+    /// Returns true if the points were successfully returned. Returns false and clears points if the size of
+    /// parameters isn't a multiple of 2.
+    bool getPointsAtParameters(const std::vector<double>& parameters, std::vector<double>& points) const;
+
+    /// Get the points on the surface that correspond to evaluating a set of parameter positions on the surface,
+    /// writing the coordinates into a buffer supplied by the caller.
+    /// parameters : The parameter positions to evaluate the surface position at, stored as u, v for each position.
+    /// count : The number of parameter positions.
+    /// points : The output buffer, which must have room for 3 * count values. The coordinates are written as x, y, z for each position.
+    /// Returns true if the points were successfully returned.
+    bool getPointsAtParameters(const double* parameters, size_t count, double* points) const;
+
     /// Get the point on the surface that correspond to evaluating a parameter position on the surface.
     /// parameter : The parameter positions to evaluate the surface position at.
     /// The parameter position must be within the range of the parameter extents as verified by isParameterOnFace.
@@ -261,6 +300,120 @@ public:
     /// edges and has a well-defined area.
     double area() const;
 
+    /// Computes the area, centroid and second moments of area of the surface. The integration is
+    /// performed using adaptive Gauss quadrature over the parametricRange of the surface, where
+    /// parameter positions that fail isParameterOnFace are excluded, so the results respect the
+    /// boundaries of a face. Patches of the parameter range are subdivided until the requested
+    /// tolerance is met or no further improvement is possible.
+    /// As with the area property, this can fail when the SurfaceEvaluator is associated with one of
+    /// the unbounded geometry classes.
+    /// tolerance : The relative accuracy requested for the computed area. This must be greater than zero.
+    /// area : The output area of the surface in square centimeters.
+    /// centroid : The output centroid of the surface.
+    /// secondMoments : The output array of the six second moments of area, taken with respect to the model
+    /// origin, in the order Ixx, Iyy, Izz, Ixy, Iyz, Ixz.
+    /// accuracy : The output estimate of the relative accuracy that was actually achieved. This will be
+    /// equal to or smaller than the requested tolerance unless the integration failed to converge.
+    /// Returns true if the area properties were successfully computed.
+    bool getAreaProperties(double tolerance, double& area, Ptr<Point3D>& centroid, std::vector<double>& secondMoments, double& accuracy) const;
+
+    /// Computes the area, centroid and second moments of area of a set of surfaces in a single call.
+    /// Each surface is integrated the same way as getAreaProperties and the surfaces are integrated
+    /// concurrently, so this is much faster than calling getAreaProperties for each surface when
+    /// computing the properties of many faces or parts.
+    /// evaluators : The array of surface evaluators to integrate.
+    /// tolerance : The relative accuracy requested for the computed area of each surface. This must be greater than zero.
+    /// areas : The output array of areas, one for each evaluator.
+    /// centroids : The output array of centroids, one for each evaluator. The centroid is null for any surface that failed.
+    /// secondMoments : The output array of second moments of area. Six values are returned for each
+    /// evaluator, in the same order as described for getAreaProperties, so the length of this array is
+    /// six times the length of the evaluators array.
+    /// accuracies : The output array of the relative accuracy achieved for each evaluator. A negative value
+    /// indicates the integration of that surface failed, for example because it is unbounded.
+    /// Returns true if the properties of all of the surfaces were successfully computed. If false is returned,
+    /// the accuracies array can be used to determine which surfaces failed.
+    static bool getAreaPropertiesOfSurfaces(const std::vector<Ptr<SurfaceEvaluator>>& evaluators, double tolerance, std::vector<double>& areas, std::vector<Ptr<Point3D>>& centroids, std::vector<double>& secondMoments, std::vector<double>& accuracies);
+
+    /// Computes a curvature map of the surface over a regular grid of parameter positions.
+    /// The grid spans the parametricRange of the surface with uCount positions in U and vCount positions
+    /// in V, including the ends of the range. The results are returned in flat arrays with one value for
+    /// each grid position, ordered so the U index varies fastest; the value for the position (i, j) is
+    /// at index j * uCount + i. The grid positions are evaluated concurrently.
+    /// uCount : The number of grid positions in the U direction. This must be 2 or greater.
+    /// vCount : The number of grid positions in the V direction. This must be 2 or greater.
+    /// gaussianCurvatures : The output array of Gaussian curvatures, the product of the principal curvatures.
+    /// meanCurvatures : The output array of mean curvatures, the average of the principal curvatures.
+    /// maxCurvatures : The output array of the maximum principal curvatures.
+    /// minCurvatures : The output array of the minimum principal curvatures.
+    /// Curvatures are signed with respect to the surface normal, where a negative curvature indicates the
+    /// surface is concave in that direction.
+    /// minConcaveRadii : The output array of the smallest concave radius at each grid position. This is the
+    /// largest radius of a ball that can touch the surface at that position from the side the normal points to.
+    /// Where the surface is not concave in any direction, the value is the largest float value.
+    /// isOnFace : The output array that indicates which grid positions lie on the face, as determined by
+    /// isParameterOnFace. The values of the other arrays are zero at positions that are not on the face.
+    /// minConcaveRadius : The output smallest concave radius of all the grid positions on the face. This
+    /// is the smallest value in minConcaveRadii and is useful when choosing the largest tool that fits the surface.
+    /// Returns true if the curvature map was successfully computed.
+    bool getCurvatureMap(int uCount, int vCount, std::vector<float>& gaussianCurvatures, std::vector<float>& meanCurvatures, std::vector<float>& maxCurvatures, std::vector<float>& minCurvatures, std::vector<float>& minConcaveRadii, std::vector<bool>& isOnFace, double& minConcaveRadius) const;
+
+    /// Gets (by extraction) a family of curves that follow constant u or v parameters along the surface.
+    /// This is equivalent to calling getIsoCurve for each of the specified parameters, but the knot span
+    /// and basis function data of the surface is computed once and shared by all of the extractions and
+    /// the parameters are processed concurrently.
+    /// uParameters : The array of U parameters at which to extract curves.
+    /// vParameters : The array of V parameters at which to extract curves.
+    /// curves : The output array of extracted curves. As with getIsoCurve, multiple curves can be returned for a
+    /// single parameter when the SurfaceEvaluator is obtained from a face and the curve cuts across internal boundaries.
+    /// parameterIndices : The output array that identifies the parameter each curve was extracted at. The length of
+    /// this array is the same as the curves array. Indices less than the length of uParameters refer to uParameters, and
+    /// the remaining indices refer to vParameters, offset by the length of uParameters.
+    /// Returns true if the curves were successfully extracted.
+    bool getIsoCurves(const std::vector<double>& uParameters, const std::vector<double>& vParameters, std::vector<Ptr<Curve3D>>& curves, std::vector<int>& parameterIndices) const;
+
+    /// Gets a family of iso-parametric curves as strokes (polylines) without creating any curve objects.
+    /// The curves are the same as those returned by getIsoCurves and are stroked to the specified tolerance.
+    /// The vertices of all of the strokes are written to a single flat array, which makes this the most
+    /// efficient way to get iso-parametric tool paths or display data for many parameters.
+    /// uParameters : The array of U parameters at which to extract curves.
+    /// vParameters : The array of V parameters at which to extract curves.
+    /// tolerance : The maximum distance in centimeters between a stroke and the curve it approximates.
+    /// vertexCoordinates : The output array of vertex coordinates of all of the strokes in the form
+    /// [x0, y0, z0, x1, y1, z1, ...]. The vertices of each stroke follow the vertices of the previous stroke.
+    /// vertexCounts : The output array of the number of vertices in each stroke.
+    /// parameterIndices : The output array that identifies the parameter each stroke was extracted at, using the
+    /// same indexing as getIsoCurves. The length of this array is the same as the vertexCounts array.
+    /// Returns true if the strokes were successfully computed.
+    bool getIsoCurveStrokes(const std::vector<double>& uParameters, const std::vector<double>& vParameters, double tolerance, std::vector<double>& vertexCoordinates, std::vector<int>& vertexCounts, std::vector<int>& parameterIndices) const;
+
+    /// Creates the 3D equivalent curves in model space of a set of 2D curves defined in the parametric
+    /// space of the surface. This is equivalent to calling getModelCurveFromParametricCurve for each of
+    /// the curves but the curves are mapped concurrently in a single call, which is significantly faster
+    /// when mapping a large number of curves, such as the outlines of text or a hatch pattern.
+    /// parametricCurves : The array of parameter space curves to map onto the surface.
+    /// modelCurves : The output array of model space curves. As with getModelCurveFromParametricCurve, multiple
+    /// curves can be returned for a single parametric curve when the SurfaceEvaluator is obtained from a face and
+    /// the curve cuts across internal boundaries of the face.
+    /// curveIndices : The output array that identifies the index of the parametric curve each model curve was
+    /// created from. The length of this array is the same as the modelCurves array.
+    /// Returns true if the curves were successfully mapped.
+    bool getModelCurvesFromParametricCurves(const std::vector<Ptr<Curve2D>>& parametricCurves, std::vector<Ptr<Curve3D>>& modelCurves, std::vector<int>& curveIndices) const;
+
+    /// Maps a set of 2D curves defined in the parametric space of the surface into model space as strokes
+    /// (polylines). The curves are sampled directly on the surface until the strokes are within the
+    /// specified tolerance of the true model space curves, so no intermediate model space curves are
+    /// created. The curves are processed concurrently.
+    /// parametricCurves : The array of parameter space curves to map onto the surface.
+    /// tolerance : The maximum distance in centimeters, measured in model space, between a stroke and the
+    /// curve it approximates.
+    /// vertexCoordinates : The output array of vertex coordinates of all of the strokes in the form
+    /// [x0, y0, z0, x1, y1, z1, ...]. The vertices of each stroke follow the vertices of the previous stroke.
+    /// vertexCounts : The output array of the number of vertices in each stroke.
+    /// curveIndices : The output array that identifies the index of the parametric curve each stroke was
+    /// created from. The length of this array is the same as the vertexCounts array.
+    /// Returns true if the strokes were successfully computed.
+    bool getModelStrokesFromParametricCurves(const std::vector<Ptr<Curve2D>>& parametricCurves, double tolerance, std::vector<double>& vertexCoordinates, std::vector<int>& vertexCounts, std::vector<int>& curveIndices) const;
+
     ADSK_CORE_SURFACEEVALUATOR_API static const char* classType();
     ADSK_CORE_SURFACEEVALUATOR_API const char* objectType() const override;
     ADSK_CORE_SURFACEEVALUATOR_API void* queryInterface(const char* id) const override;
@@ -293,6 +446,15 @@ private:
     virtual bool isParameterOnFace_raw(Point2D* parameter) const = 0;
     virtual BoundingBox2D* parametricRange_raw() const = 0;
     virtual double area_raw() const = 0;
+    virtual bool getAreaProperties_raw(double tolerance, double& area, Point3D*& centroid, double*& secondMoments, size_t& secondMoments_size, double& accuracy) const = 0;
+    ADSK_CORE_SURFACEEVALUATOR_API static bool getAreaPropertiesOfSurfaces_raw(SurfaceEvaluator** evaluators, size_t evaluators_size, double tolerance, double*& areas, size_t& areas_size, Point3D**& centroids, size_t& centroids_size, double*& secondMoments, size_t& secondMoments_size, double*& accuracies, size_t& accuracies_size);
+    virtual bool getCurvatureMap_raw(int uCount, int vCount, float*& gaussianCurvatures, size_t& gaussianCurvatures_size, float*& meanCurvatures, size_t& meanCurvatures_size, float*& maxCurvatures, size_t& maxCurvatures_size, float*& minCurvatures, size_t& minCurvatures_size, float*& minConcaveRadii, size_t& minConcaveRadii_size, bool*& isOnFace, size_t& isOnFace_size, double& minConcaveRadius) const = 0;
+    virtual bool getIsoCurves_raw(const double* uParameters, size_t uParameters_size, const double* vParameters, size_t vParameters_size, Curve3D**& curves, size_t& curves_size, int*& parameterIndices, size_t& parameterIndices_size) const = 0;
+    virtual bool getIsoCurveStrokes_raw(const double* uParameters, size_t uParameters_size, const double* vParameters, size_t vParameters_size, double tolerance, double*& vertexCoordinates, size_t& vertexCoordinates_size, int*& vertexCounts, size_t& vertexCounts_size, int*& parameterIndices, size_t& parameterIndices_size) const = 0;
+    virtual bool getModelCurvesFromParametricCurves_raw(Curve2D** parametricCurves, size_t parametricCurves_size, Curve3D**& modelCurves, size_t& modelCurves_size, int*& curveIndices, size_t& curveIndices_size) const = 0;
+    virtual bool getModelStrokesFromParametricCurves_raw(Curve2D** parametricCurves, size_t parametricCurves_size, double tolerance, double*& vertexCoordinates, size_t& vertexCoordinates_size, int*& vertexCounts, size_t& vertexCounts_size, int*& curveIndices, size_t& curveIndices_size) const = 0;
+    virtual bool getPointsAtParametersFlat_raw(const double* parameters, size_t count, double* points) const = 0;
+    virtual bool getNormalsAtPointsFlat_raw(const double* points, size_t count, double* normals) const = 0;
 };
 
 // Inline wrappers
@@ -323,7 +485,7 @@ inline Ptr<ObjectCollection> SurfaceEvaluator::getIsoCurve(double parameter, boo
 
 inline bool SurfaceEvaluator::getCurvatures(const std::vector<Ptr<Point2D>>& parameters, std::vector<Ptr<Vector3D>>& maxTangents, std::vector<double>& maxCurvatures, std::vector<double>& minCurvatures) const
 {
-    Point2D** parameters_ = new Point2D*[parameters.size()];
+    ScratchArray<Point2D*> parameters_(parameters.size());
     for(size_t i=0; i<parameters.size(); ++i)
         parameters_[i] = parameters[i].get();
     Vector3D** maxTangents_ = nullptr;
@@ -334,7 +496,6 @@ inline bool SurfaceEvaluator::getCurvatures(const std::vector<Ptr<Point2D>>& par
     size_t minCurvatures_size;
 
     bool res = getCurvatures_raw(parameters_, parameters.size(), maxTangents_, maxTangents_size, maxCurvatures_, maxCurvatures_size, minCurvatures_, minCurvatures_size);
-    delete[] parameters_;
     if(maxTangents_)
     {
         maxTangents.assign(maxTangents_, maxTangents_ + maxTangents_size);
@@ -364,14 +525,13 @@ inline bool SurfaceEvaluator::getCurvature(const Ptr<Point2D>& parameter, Ptr<Ve
 
 inline bool SurfaceEvaluator::getNormalsAtParameters(const std::vector<Ptr<Point2D>>& parameters, std::vector<Ptr<Vector3D>>& normals) const
 {
-    Point2D** parameters_ = new Point2D*[parameters.size()];
+    ScratchArray<Point2D*> parameters_(parameters.size());
     for(size_t i=0; i<parameters.size(); ++i)
         parameters_[i] = parameters[i].get();
     Vector3D** normals_ = nullptr;
     size_t normals_size;
 
     bool res = getNormalsAtParameters_raw(parameters_, parameters.size(), normals_, normals_size);
-    delete[] parameters_;
     if(normals_)
     {
         normals.assign(normals_, normals_ + normals_size);
@@ -391,14 +551,13 @@ inline bool SurfaceEvaluator::getNormalAtParameter(const Ptr<Point2D>& parameter
 
 inline bool SurfaceEvaluator::getNormalsAtPoints(const std::vector<Ptr<Point3D>>& points, std::vector<Ptr<Vector3D>>& normals) const
 {
-    Point3D** points_ = new Point3D*[points.size()];
+    ScratchArray<Point3D*> points_(points.size());
     for(size_t i=0; i<points.size(); ++i)
         points_[i] = points[i].get();
     Vector3D** normals_ = nullptr;
     size_t normals_size;
 
     bool res = getNormalsAtPoints_raw(points_, points.size(), normals_, normals_size);
-    delete[] points_;
     if(normals_)
     {
         normals.assign(normals_, normals_ + normals_size);
@@ -407,6 +566,26 @@ inline bool SurfaceEvaluator::getNormalsAtPoints(const std::vector<Ptr<Point3D>>
     return res;
 }
 
+inline bool SurfaceEvaluator::getNormalsAtPoints(const std::vector<double>& points, std::vector<double>& normals) const
+{
+    if(points.size() % 3 != 0)
+    {
+        normals.clear();
+        return false;
+    }
+
+    size_t count = points.size() / 3;
+    normals.resize(count * 3);
+    bool res = getNormalsAtPointsFlat_raw(points.empty() ? nullptr : &points[0], count, normals.empty() ? nullptr : &normals[0]);
+    return res;
+}
+
+inline bool SurfaceEvaluator::getNormalsAtPoints(const double* points, size_t count, double* normals) const
+{
+    bool res = getNormalsAtPointsFlat_raw(points, count, normals);
+    return res;
+}
+
 inline bool SurfaceEvaluator::getNormalAtPoint(const Ptr<Point3D>& point, Ptr<Vector3D>& normal) const
 {
     Vector3D* normal_ = nullptr;
@@ -418,14 +597,13 @@ inline bool SurfaceEvaluator::getNormalAtPoint(const Ptr<Point3D>& point, Ptr<Ve
 
 inline bool SurfaceEvaluator::getParametersAtPoints(const std::vector<Ptr<Point3D>>& points, std::vector<Ptr<Point2D>>& parameters) const
 {
-    Point3D** points_ = new Point3D*[points.size()];
+    ScratchArray<Point3D*> points_(points.size());
     for(size_t i=0; i<points.size(); ++i)
         points_[i] = points[i].get();
     Point2D** parameters_ = nullptr;
     size_t parameters_size;
 
     bool res = getParametersAtPoints_raw(points_, points.size(), parameters_, parameters_size);
-    delete[] points_;
     if(parameters_)
     {
         parameters.assign(parameters_, parameters_ + parameters_size);
@@ -445,14 +623,13 @@ inline bool SurfaceEvaluator::getParameterAtPoint(const Ptr<Point3D>& point, Ptr
 
 inline bool SurfaceEvaluator::getPointsAtParameters(const std::vector<Ptr<Point2D>>& parameters, std::vector<Ptr<Point3D>>& points) const
 {
-    Point2D** parameters_ = new Point2D*[parameters.size()];
+    ScratchArray<Point2D*> parameters_(parameters.size());
     for(size_t i=0; i<parameters.size(); ++i)
         parameters_[i] = parameters[i].get();
     Point3D** points_ = nullptr;
     size_t points_size;
 
     bool res = getPointsAtParameters_raw(parameters_, parameters.size(), points_, points_size);
-    delete[] parameters_;
     if(points_)
     {
         points.assign(points_, points_ + points_size);
@@ -461,6 +638,26 @@ inline bool SurfaceEvaluator::getPointsAtParameters(const std::vector<Ptr<Point2
     return res;
 }
 
+inline bool SurfaceEvaluator::getPointsAtParameters(const std::vector<double>& parameters, std::vector<double>& points) const
+{
+    if(parameters.size() % 2 != 0)
+    {
+        points.clear();
+        return false;
+    }
+
+    size_t count = parameters.size() / 2;
+    points.resize(count * 3);
+    bool res = getPointsAtParametersFlat_raw(parameters.empty() ? nullptr : &parameters[0], count, points.empty() ? nullptr : &points[0]);
+    return res;
+}
+
+inline bool SurfaceEvaluator::getPointsAtParameters(const double* parameters, size_t count, double* points) const
+{
+    bool res = getPointsAtParametersFlat_raw(parameters, count, points);
+    return res;
+}
+
 inline bool SurfaceEvaluator::getPointAtParameter(const Ptr<Point2D>& parameter, Ptr<Point3D>& point) const
 {
     Point3D* point_ = nullptr;
@@ -514,7 +711,7 @@ inline bool SurfaceEvaluator::getParamAnomaly(std::vector<double>& periodicityU,
 
 inline bool SurfaceEvaluator::getFirstDerivatives(const std::vector<Ptr<Point2D>>& parameters, std::vector<Ptr<Vector3D>>& partialsU, std::vector<Ptr<Vector3D>>& partialsV) const
 {
-    Point2D** parameters_ = new Point2D*[parameters.size()];
+    ScratchArray<Point2D*> parameters_(parameters.size());
     for(size_t i=0; i<parameters.size(); ++i)
         parameters_[i] = parameters[i].get();
     Vector3D** partialsU_ = nullptr;
@@ -523,7 +720,6 @@ inline bool SurfaceEvaluator::getFirstDerivatives(const std::vector<Ptr<Point2D>
     size_t partialsV_size;
 
     bool res = getFirstDerivatives_raw(parameters_, parameters.size(), partialsU_, partialsU_size, partialsV_, partialsV_size);
-    delete[] parameters_;
     if(partialsU_)
     {
         partialsU.assign(partialsU_, partialsU_ + partialsU_size);
@@ -550,7 +746,7 @@ inline bool SurfaceEvaluator::getFirstDerivative(const Ptr<Point2D>& parameter,
 
 inline bool SurfaceEvaluator::getSecondDerivatives(const std::vector<Ptr<Point2D>>& parameters, std::vector<Ptr<Vector3D>>& partialsUU, std::vector<Ptr<Vector3D>>& partialsUV, std::vector<Ptr<Vector3D>>& partialsVV) const
 {
-    Point2D** parameters_ = new Point2D*[parameters.size()];
+    ScratchArray<Point2D*> parameters_(parameters.size());
     for(size_t i=0; i<parameters.size(); ++i)
         parameters_[i] = parameters[i].get();
     Vector3D** partialsUU_ = nullptr;
@@ -561,7 +757,6 @@ inline bool SurfaceEvaluator::getSecondDerivatives(const std::vector<Ptr<Point2D
     size_t partialsVV_size;
 
     bool res = getSecondDerivatives_raw(parameters_, parameters.size(), partialsUU_, partialsUU_size, partialsUV_, partialsUV_size, partialsVV_, partialsVV_size);
-    delete[] parameters_;
     if(partialsUU_)
     {
         partialsUU.assign(partialsUU_, partialsUU_ + partialsUU_size);
@@ -595,7 +790,7 @@ inline bool SurfaceEvaluator::getSecondDerivative(const Ptr<Point2D>& parameter,
 
 inline bool SurfaceEvaluator::getThirdDerivatives(const std::vector<Ptr<Point2D>>& parameters, std::vector<Ptr<Vector3D>>& partialsUUU, std::vector<Ptr<Vector3D>>& partialsVVV) const
 {
-    Point2D** parameters_ = new Point2D*[parameters.size()];
+    ScratchArray<Point2D*> parameters_(parameters.size());
     for(size_t i=0; i<parameters.size(); ++i)
         parameters_[i] = parameters[i].get();
     Vector3D** partialsUUU_ = nullptr;
@@ -604,7 +799,6 @@ inline bool SurfaceEvaluator::getThirdDerivatives(const std::vector<Ptr<Point2D>
     size_t partialsVVV_size;
 
     bool res = getThirdDerivatives_raw(parameters_, parameters.size(), partialsUUU_, partialsUUU_size, partialsVVV_, partialsVVV_size);
-    delete[] parameters_;
     if(partialsUUU_)
     {
         partialsUUU.assign(partialsUUU_, partialsUUU_ + partialsUUU_size);
@@ -646,6 +840,213 @@ inline double SurfaceEvaluator::area() const
     double res = area_raw();
     return res;
 }
+
+inline bool SurfaceEvaluator::getAreaProperties(double tolerance, double& area, Ptr<Point3D>& centroid, std::vector<double>& secondMoments, double& accuracy) const
+{
+    Point3D* centroid_ = nullptr;
+    double* secondMoments_ = nullptr;
+    size_t secondMoments_size;
+
+    bool res = getAreaProperties_raw(tolerance, area, centroid_, secondMoments_, secondMoments_size, accuracy);
+    centroid = centroid_;
+    if(secondMoments_)
+    {
+        secondMoments.assign(secondMoments_, secondMoments_ + secondMoments_size);
+        DeallocateArray(secondMoments_);
+    }
+    return res;
+}
+
+inline bool SurfaceEvaluator::getAreaPropertiesOfSurfaces(const std::vector<Ptr<SurfaceEvaluator>>& evaluators, double tolerance, std::vector<double>& areas, std::vector<Ptr<Point3D>>& centroids, std::vector<double>& secondMoments, std::vector<double>& accuracies)
+{
+    ScratchArray<SurfaceEvaluator*> evaluators_(evaluators.size());
+    for(size_t i=0; i<evaluators.size(); ++i)
+        evaluators_[i] = evaluators[i].get();
+    double* areas_ = nullptr;
+    size_t areas_size;
+    Point3D** centroids_ = nullptr;
+    size_t centroids_size;
+    double* secondMoments_ = nullptr;
+    size_t secondMoments_size;
+    double* accuracies_ = nullptr;
+    size_t accuracies_size;
+
+    bool res = getAreaPropertiesOfSurfaces_raw(evaluators_, evaluators.size(), tolerance, areas_, areas_size, centroids_, centroids_size, secondMoments_, secondMoments_size, accuracies_, accuracies_size);
+    if(areas_)
+    {
+        areas.assign(areas_, areas_ + areas_size);
+        DeallocateArray(areas_);
+    }
+    if(centroids_)
+    {
+        centroids.assign(centroids_, centroids_ + centroids_size);
+        DeallocateArray(centroids_);
+    }
+    if(secondMoments_)
+    {
+        secondMoments.assign(secondMoments_, secondMoments_ + secondMoments_size);
+        DeallocateArray(secondMoments_);
+    }
+    if(accuracies_)
+    {
+        accuracies.assign(accuracies_, accuracies_ + accuracies_size);
+        DeallocateArray(accuracies_);
+    }
+    return res;
+}
+
+inline bool SurfaceEvaluator::getCurvatureMap(int uCount, int vCount, std::vector<float>& gaussianCurvatures, std::vector<float>& meanCurvatures, std::vector<float>& maxCurvatures, std::vector<float>& minCurvatures, std::vector<float>& minConcaveRadii, std::vector<bool>& isOnFace, double& minConcaveRadius) const
+{
+    float* gaussianCurvatures_ = nullptr;
+    size_t gaussianCurvatures_size;
+    float* meanCurvatures_ = nullptr;
+    size_t meanCurvatures_size;
+    float* maxCurvatures_ = nullptr;
+    size_t maxCurvatures_size;
+    float* minCurvatures_ = nullptr;
+    size_t minCurvatures_size;
+    float* minConcaveRadii_ = nullptr;
+    size_t minConcaveRadii_size;
+    bool* isOnFace_ = nullptr;
+    size_t isOnFace_size;
+
+    bool res = getCurvatureMap_raw(uCount, vCount, gaussianCurvatures_, gaussianCurvatures_size, meanCurvatures_, meanCurvatures_size, maxCurvatures_, maxCurvatures_size, minCurvatures_, minCurvatures_size, minConcaveRadii_, minConcaveRadii_size, isOnFace_, isOnFace_size, minConcaveRadius);
+    if(gaussianCurvatures_)
+    {
+        gaussianCurvatures.assign(gaussianCurvatures_, gaussianCurvatures_ + gaussianCurvatures_size);
+        DeallocateArray(gaussianCurvatures_);
+    }
+    if(meanCurvatures_)
+    {
+        meanCurvatures.assign(meanCurvatures_, meanCurvatures_ + meanCurvatures_size);
+        DeallocateArray(meanCurvatures_);
+    }
+    if(maxCurvatures_)
+    {
+        maxCurvatures.assign(maxCurvatures_, maxCurvatures_ + maxCurvatures_size);
+        DeallocateArray(maxCurvatures_);
+    }
+    if(minCurvatures_)
+    {
+        minCurvatures.assign(minCurvatures_, minCurvatures_ + minCurvatures_size);
+        DeallocateArray(minCurvatures_);
+    }
+    if(minConcaveRadii_)
+    {
+        minConcaveRadii.assign(minConcaveRadii_, minConcaveRadii_ + minConcaveRadii_size);
+        DeallocateArray(minConcaveRadii_);
+    }
+    if(isOnFace_)
+    {
+        isOnFace.assign(isOnFace_, isOnFace_ + isOnFace_size);
+        DeallocateArray(isOnFace_);
+    }
+    return res;
+}
+
+inline bool SurfaceEvaluator::getIsoCurves(const std::vector<double>& uParameters, const std::vector<double>& vParameters, std::vector<Ptr<Curve3D>>& curves, std::vector<int>& parameterIndices) const
+{
+    Curve3D** curves_ = nullptr;
+    size_t curves_size;
+    int* parameterIndices_ = nullptr;
+    size_t parameterIndices_size;
+
+    bool res = getIsoCurves_raw(uParameters.empty() ? nullptr : &uParameters[0], uParameters.size(), vParameters.empty() ? nullptr : &vParameters[0], vParameters.size(), curves_, curves_size, parameterIndices_, parameterIndices_size);
+    if(curves_)
+    {
+        curves.assign(curves_, curves_ + curves_size);
+        DeallocateArray(curves_);
+    }
+    if(parameterIndices_)
+    {
+        parameterIndices.assign(parameterIndices_, parameterIndices_ + parameterIndices_size);
+        DeallocateArray(parameterIndices_);
+    }
+    return res;
+}
+
+inline bool SurfaceEvaluator::getIsoCurveStrokes(const std::vector<double>& uParameters, const std::vector<double>& vParameters, double tolerance, std::vector<double>& vertexCoordinates, std::vector<int>& vertexCounts, std::vector<int>& parameterIndices) const
+{
+    double* vertexCoordinates_ = nullptr;
+    size_t vertexCoordinates_size;
+    int* vertexCounts_ = nullptr;
+    size_t vertexCounts_size;
+    int* parameterIndices_ = nullptr;
+    size_t parameterIndices_size;
+
+    bool res = getIsoCurveStrokes_raw(uParameters.empty() ? nullptr : &uParameters[0], uParameters.size(), vParameters.empty() ? nullptr : &vParameters[0], vParameters.size(), tolerance, vertexCoordinates_, vertexCoordinates_size, vertexCounts_, vertexCounts_size, parameterIndices_, parameterIndices_size);
+    if(vertexCoordinates_)
+    {
+        vertexCoordinates.assign(vertexCoordinates_, vertexCoordinates_ + vertexCoordinates_size);
+        DeallocateArray(vertexCoordinates_);
+    }
+    if(vertexCounts_)
+    {
+        vertexCounts.assign(vertexCounts_, vertexCounts_ + vertexCounts_size);
+        DeallocateArray(vertexCounts_);
+    }
+    if(parameterIndices_)
+    {
+        parameterIndices.assign(parameterIndices_, parameterIndices_ + parameterIndices_size);
+        DeallocateArray(parameterIndices_);
+    }
+    return res;
+}
+
+inline bool SurfaceEvaluator::getModelCurvesFromParametricCurves(const std::vector<Ptr<Curve2D>>& parametricCurves, std::vector<Ptr<Curve3D>>& modelCurves, std::vector<int>& curveIndices) const
+{
+    ScratchArray<Curve2D*> parametricCurves_(parametricCurves.size());
+    for(size_t i=0; i<parametricCurves.size(); ++i)
+        parametricCurves_[i] = parametricCurves[i].get();
+    Curve3D** modelCurves_ = nullptr;
+    size_t modelCurves_size;
+    int* curveIndices_ = nullptr;
+    size_t curveIndices_size;
+
+    bool res = getModelCurvesFromParametricCurves_raw(parametricCurves_, parametricCurves.size(), modelCurves_, modelCurves_size, curveIndices_, curveIndices_size);
+    if(modelCurves_)
+    {
+        modelCurves.assign(modelCurves_, modelCurves_ + modelCurves_size);
+        DeallocateArray(modelCurves_);
+    }
+    if(curveIndices_)
+    {
+        curveIndices.assign(curveIndices_, curveIndices_ + curveIndices_size);
+        DeallocateArray(curveIndices_);
+    }
+    return res;
+}
+
+inline bool SurfaceEvaluator::getModelStrokesFromParametricCurves(const std::vector<Ptr<Curve2D>>& parametricCurves, double tolerance, std::vector<double>& vertexCoordinates, std::vector<int>& vertexCounts, std::vector<int>& curveIndices) const
+{
+    ScratchArray<Curve2D*> parametricCurves_(parametricCurves.size());
+    for(size_t i=0; i<parametricCurves.size(); ++i)
+        parametricCurves_[i] = parametricCurves[i].get();
+    double* vertexCoordinates_ = nullptr;
+    size_t vertexCoordinates_size;
+    int* vertexCounts_ = nullptr;
+    size_t vertexCounts_size;
+    int* curveIndices_ = nullptr;
+    size_t curveIndices_size;
+
+    bool res = getModelStrokesFromParametricCurves_raw(parametricCurves_, parametricCurves.size(), tolerance, vertexCoordinates_, vertexCoordinates_size, vertexCounts_, vertexCounts_size, curveIndices_, curveIndices_size);
+    if(vertexCoordinates_)
+    {
+        vertexCoordinates.assign(vertexCoordinates_, vertexCoordinates_ + vertexCoordinates_size);
+        DeallocateArray(vertexCoordinates_);
+    }
+    if(vertexCounts_)
+    {
+        vertexCounts.assign(vertexCounts_, vertexCounts_ + vertexCounts_size);
+        DeallocateArray(vertexCounts_);
+    }
+    if(curveIndices_)
+    {
+        curveIndices.assign(curveIndices_, curveIndices_ + curveIndices_size);
+        DeallocateArray(curveIndices_);
+    }
+    return res;
+}
 }// namespace core
 }// namespace adsk
 
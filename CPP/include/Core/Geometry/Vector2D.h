@@ -69,6 +69,11 @@ public:
     /// Returns an array of the vector's values [x, y].
     std::vector<double> asArray() const;
 
+    /// Gets the components of the vector without allocating an array.
+    /// coordinates : The output buffer, which must have room for 2 values. The values are written in the same order as returned by asArray.
+    /// Returns true if the values were successfully returned.
+    bool getAsArray(double* coordinates) const;
+
     /// Compare this vector with another to check for equality.
     /// vector : The vector to compare with for equality.
     /// Returns true if the vectors are equal.
@@ -153,6 +158,7 @@ private:
     virtual bool x_raw(double value) = 0;
     virtual double y_raw() const = 0;
     virtual bool y_raw(double value) = 0;
+    virtual bool getAsArray_raw(double* coordinates) const = 0;
 };
 
 // Inline wrappers
@@ -201,6 +207,12 @@ inline std::vector<double> Vector2D::asArray() const
     return res;
 }
 
+inline bool Vector2D::getAsArray(double* coordinates) const
+{
+    bool res = getAsArray_raw(coordinates);
+    return res;
+}
+
 inline bool Vector2D::isEqualTo(const Ptr<Vector2D>& vector) const
 {
     bool res = isEqualTo_raw(vector.get());
@@ -37,6 +37,7 @@ namespace adsk { namespace core {
 /// Transient 3D vector. This object is a wrapper over 3D vector data and is used as way to pass vector data
 /// in and out of the API and as a convenience when operating on vector data.
 /// They are created statically using the create method of the Vector3D class.
+/// Vectors can be used from worker threads as described for CurveEvaluator3D.
 class Vector3D : public Base {
 public:
 
@@ -79,6 +80,11 @@ public:
     /// Returns the array of vector coordinates [x, y, z].
     std::vector<double> asArray() const;
 
+    /// Gets the components of the vector without allocating an array.
+    /// coordinates : The output buffer, which must have room for 3 values. The values are written in the same order as returned by asArray.
+    /// Returns true if the values were successfully returned.
+    bool getAsArray(double* coordinates) const;
+
     /// Determines if this vector is equal to the specified vector.
     /// vector : The vector to test equality to.
     /// Returns true if the vectors are equal.
@@ -165,6 +171,7 @@ private:
     virtual bool y_raw(double value) = 0;
     virtual double z_raw() const = 0;
     virtual bool z_raw(double value) = 0;
+    virtual bool getAsArray_raw(double* coordinates) const = 0;
 };
 
 // Inline wrappers
@@ -225,6 +232,12 @@ inline std::vector<double> Vector3D::asArray() const
     return res;
 }
 
+inline bool Vector3D::getAsArray(double* coordinates) const
+{
+    bool res = getAsArray_raw(coordinates);
+    return res;
+}
+
 inline bool Vector3D::isEqualTo(const Ptr<Vector3D>& vector) const
 {
     bool res = isEqualTo_raw(vector.get());
@@ -11,7 +11,9 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -51,11 +53,23 @@ public:
     /// Returns the specified appearance or null if there isn't a matching name.
     Ptr<Appearance> itemByName(const std::string& name) const;
 
+    /// Returns the items that match a set of names in a single call, instead of one call to itemByName for each name.
+    /// names : The names of the items to return.
+    /// Returns an array the same length as names where each entry is the appearance with the corresponding name, or
+    /// null if the name doesn't match an item within the collection.
+    std::vector<Ptr<Appearance>> itemsByName(const std::vector<std::string>& names) const;
+
     /// Returns the Appearance by it's internal unique ID.
     /// id : The ID of the appearance to return.
     /// Returns the specified appearance or null if there isn't a matching ID.
     Ptr<Appearance> itemById(const std::string& id) const;
 
+    /// Returns the items that match a set of unique IDs in a single call, instead of one call to itemById for each ID.
+    /// ids : The unique IDs of the items to return.
+    /// Returns an array the same length as ids where each entry is the appearance with the corresponding id, or
+    /// null if the id doesn't match an item within the collection.
+    std::vector<Ptr<Appearance>> itemsById(const std::vector<std::string>& ids) const;
+
     /// Add an Appearance to a Design by copying an existing Appearance from Favorites, a Library or from the
     /// appearances stored in the Design. This method currently only applies to the Appearances collection from a Design and
     /// cannot be used to copy an Appearance to a library.
@@ -65,6 +79,10 @@ public:
     /// Returns the newly created Appearance or null if the copy operation failed.
     Ptr<Appearance> addByCopy(const Ptr<Appearance>& appearanceToCopy, const std::string& name);
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Appearance>> asArray() const;
+
     typedef Appearance iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -81,6 +99,9 @@ private:
     virtual Appearance* itemByName_raw(const char* name) const = 0;
     virtual Appearance* itemById_raw(const char* id) const = 0;
     virtual Appearance* addByCopy_raw(Appearance* appearanceToCopy, const char* name) = 0;
+    virtual Appearance** asArray_raw(size_t& return_size) const = 0;
+    virtual Appearance** itemsById_raw(const char** ids, size_t ids_size, size_t& return_size) const = 0;
+    virtual Appearance** itemsByName_raw(const char** names, size_t names_size, size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -103,21 +124,75 @@ inline Ptr<Appearance> Appearances::itemByName(const std::string& name) const
     return res;
 }
 
+inline std::vector<Ptr<Appearance>> Appearances::itemsByName(const std::vector<std::string>& names) const
+{
+    ScratchArray<const char*> names_(names.size());
+    for(size_t i = 0; i < names.size(); ++i)
+    {
+        names_[i] = names[i].c_str();
+    }
+
+    std::vector<Ptr<Appearance>> res;
+    size_t s;
+
+    Appearance** p= itemsByName_raw(names_, names.size(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 inline Ptr<Appearance> Appearances::itemById(const std::string& id) const
 {
     Ptr<Appearance> res = itemById_raw(id.c_str());
     return res;
 }
 
+inline std::vector<Ptr<Appearance>> Appearances::itemsById(const std::vector<std::string>& ids) const
+{
+    ScratchArray<const char*> ids_(ids.size());
+    for(size_t i = 0; i < ids.size(); ++i)
+    {
+        ids_[i] = ids[i].c_str();
+    }
+
+    std::vector<Ptr<Appearance>> res;
+    size_t s;
+
+    Appearance** p= itemsById_raw(ids_, ids.size(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 inline Ptr<Appearance> Appearances::addByCopy(const Ptr<Appearance>& appearanceToCopy, const std::string& name)
 {
     Ptr<Appearance> res = addByCopy_raw(appearanceToCopy.get(), name.c_str());
     return res;
 }
 
+inline std::vector<Ptr<Appearance>> Appearances::asArray() const
+{
+    std::vector<Ptr<Appearance>> res;
+    size_t s;
+
+    Appearance** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void Appearances::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
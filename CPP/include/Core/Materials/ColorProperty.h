@@ -10,6 +10,7 @@
 
 #pragma once
 #include "Property.h"
+#include "../ScratchArena.h"
 #include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
@@ -133,12 +134,11 @@ inline std::vector<Ptr<Color>> ColorProperty::values() const
 
 inline bool ColorProperty::values(const std::vector<Ptr<Color>>& value)
 {
-    Color** value_ = new Color*[value.size()];
+    ScratchArray<Color*> value_(value.size());
     for(size_t i=0; i<value.size(); ++i)
         value_[i] = value[i].get();
 
     bool res = values_raw(value_, value.size());
-    delete[] value_;
     return res;
 }
 }// namespace core
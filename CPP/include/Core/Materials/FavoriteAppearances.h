@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -61,6 +62,10 @@ public:
     /// Returns the Appearance added to the favorites list or null if the operation failed.
     Ptr<Appearance> add(const Ptr<Appearance>& appearance);
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Appearance>> asArray() const;
+
     typedef Appearance iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -77,6 +82,7 @@ private:
     virtual Appearance* itemByName_raw(const char* name) const = 0;
     virtual Appearance* itemById_raw(const char* id) const = 0;
     virtual Appearance* add_raw(Appearance* appearance) = 0;
+    virtual Appearance** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -111,9 +117,23 @@ inline Ptr<Appearance> FavoriteAppearances::add(const Ptr<Appearance>& appearanc
     return res;
 }
 
+inline std::vector<Ptr<Appearance>> FavoriteAppearances::asArray() const
+{
+    std::vector<Ptr<Appearance>> res;
+    size_t s;
+
+    Appearance** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void FavoriteAppearances::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
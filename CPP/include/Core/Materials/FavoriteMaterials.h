@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -61,6 +62,10 @@ public:
     /// Returns the Material added to the favorites list or null if the operation failed.
     Ptr<Material> add(const Ptr<Material>& material);
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Material>> asArray() const;
+
     typedef Material iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -77,6 +82,7 @@ private:
     virtual Material* itemByName_raw(const char* name) const = 0;
     virtual Material* itemById_raw(const char* id) const = 0;
     virtual Material* add_raw(Material* material) = 0;
+    virtual Material** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -111,9 +117,23 @@ inline Ptr<Material> FavoriteMaterials::add(const Ptr<Material>& material)
     return res;
 }
 
+inline std::vector<Ptr<Material>> FavoriteMaterials::asArray() const
+{
+    std::vector<Ptr<Material>> res;
+    size_t s;
+
+    Material** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void FavoriteMaterials::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -10,6 +10,7 @@
 
 #pragma once
 #include "Property.h"
+#include "../ScratchArena.h"
 #include <string>
 #include <vector>
 
@@ -109,14 +110,13 @@ inline std::vector<std::string> FilenameProperty::values() const
 
 inline bool FilenameProperty::values(const std::vector<std::string>& value)
 {
-    const char** value_ = value.empty() ? nullptr : (new const char*[value.size()]);
+    ScratchArray<const char*> value_(value.size());
     for(size_t i = 0; i < value.size(); ++i)
     {
         value_[i] = value[i].c_str();
     }
 
     bool res = values_raw(value_, value.size());
-    delete[] value_;
     return res;
 }
 }// namespace core
@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -63,6 +64,10 @@ public:
     /// Returns the MaterialLibrary object representing the opened library or null in the case of failure.
     Ptr<MaterialLibrary> load(const std::string& filename);
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<MaterialLibrary>> asArray() const;
+
     typedef MaterialLibrary iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -79,6 +84,7 @@ private:
     virtual MaterialLibrary* itemByName_raw(const char* name) const = 0;
     virtual MaterialLibrary* itemById_raw(const char* id) const = 0;
     virtual MaterialLibrary* load_raw(const char* filename) = 0;
+    virtual MaterialLibrary** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -113,9 +119,23 @@ inline Ptr<MaterialLibrary> MaterialLibraries::load(const std::string& filename)
     return res;
 }
 
+inline std::vector<Ptr<MaterialLibrary>> MaterialLibraries::asArray() const
+{
+    std::vector<Ptr<MaterialLibrary>> res;
+    size_t s;
+
+    MaterialLibrary** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void MaterialLibraries::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -65,6 +66,10 @@ public:
     /// Returns the newly created Material or null if the copy operation failed.
     Ptr<Material> addByCopy(const Ptr<Material>& materialToCopy, const std::string& name);
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Material>> asArray() const;
+
     typedef Material iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -81,6 +86,7 @@ private:
     virtual Material* itemByName_raw(const char* name) const = 0;
     virtual Material* itemById_raw(const char* id) const = 0;
     virtual Material* addByCopy_raw(Material* materialToCopy, const char* name) = 0;
+    virtual Material** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -115,9 +121,23 @@ inline Ptr<Material> Materials::addByCopy(const Ptr<Material>& materialToCopy, c
     return res;
 }
 
+inline std::vector<Ptr<Material>> Materials::asArray() const
+{
+    std::vector<Ptr<Material>> res;
+    size_t s;
+
+    Material** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void Materials::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -11,7 +11,9 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -47,14 +49,30 @@ public:
     /// Returns the specified property or null if the ID doesn't match a property within the collection.
     Ptr<Property> itemById(const std::string& id) const;
 
+    /// Returns the items that match a set of unique IDs in a single call, instead of one call to itemById for each ID.
+    /// ids : The unique IDs of the items to return.
+    /// Returns an array the same length as ids where each entry is the property with the corresponding id, or
+    /// null if the id doesn't match an item within the collection.
+    std::vector<Ptr<Property>> itemsById(const std::vector<std::string>& ids) const;
+
     /// Returns the specified Property using the name of the property.
     /// name : The name of the property to return. This is the name as seen in the user interface.
     /// Returns the specified property or null if the name doesn't match a property within the collection.
     Ptr<Property> itemByName(const std::string& name) const;
 
+    /// Returns the items that match a set of names in a single call, instead of one call to itemByName for each name.
+    /// names : The names of the items to return.
+    /// Returns an array the same length as names where each entry is the property with the corresponding name, or
+    /// null if the name doesn't match an item within the collection.
+    std::vector<Ptr<Property>> itemsByName(const std::vector<std::string>& names) const;
+
     /// Returns the number of properties within the collection.
     size_t count() const;
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Property>> asArray() const;
+
     typedef Property iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -70,6 +88,9 @@ private:
     virtual Property* itemById_raw(const char* id) const = 0;
     virtual Property* itemByName_raw(const char* name) const = 0;
     virtual size_t count_raw() const = 0;
+    virtual Property** asArray_raw(size_t& return_size) const = 0;
+    virtual Property** itemsById_raw(const char** ids, size_t ids_size, size_t& return_size) const = 0;
+    virtual Property** itemsByName_raw(const char** names, size_t names_size, size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -86,21 +107,75 @@ inline Ptr<Property> Properties::itemById(const std::string& id) const
     return res;
 }
 
+inline std::vector<Ptr<Property>> Properties::itemsById(const std::vector<std::string>& ids) const
+{
+    ScratchArray<const char*> ids_(ids.size());
+    for(size_t i = 0; i < ids.size(); ++i)
+    {
+        ids_[i] = ids[i].c_str();
+    }
+
+    std::vector<Ptr<Property>> res;
+    size_t s;
+
+    Property** p= itemsById_raw(ids_, ids.size(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 inline Ptr<Property> Properties::itemByName(const std::string& name) const
 {
     Ptr<Property> res = itemByName_raw(name.c_str());
     return res;
 }
 
+inline std::vector<Ptr<Property>> Properties::itemsByName(const std::vector<std::string>& names) const
+{
+    ScratchArray<const char*> names_(names.size());
+    for(size_t i = 0; i < names.size(); ++i)
+    {
+        names_[i] = names[i].c_str();
+    }
+
+    std::vector<Ptr<Property>> res;
+    size_t s;
+
+    Property** p= itemsByName_raw(names_, names.size(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 inline size_t Properties::count() const
 {
     size_t res = count_raw();
     return res;
 }
 
+inline std::vector<Ptr<Property>> Properties::asArray() const
+{
+    std::vector<Ptr<Property>> res;
+    size_t s;
+
+    Property** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void Properties::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -37,12 +37,42 @@ public:
     /// and can change based on the current language
     std::string name() const;
 
+    /// Gets the name of this property as seen in the user interface into a string supplied by the caller. When the same string is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// name : The output string.
+    /// Returns true if the value was successfully returned.
+    bool getName(std::string& name) const;
+
+    /// Gets the name of this property as seen in the user interface, writing it as a null terminated string into a buffer supplied by the caller.
+    /// buffer : The output buffer. Nothing is written if the buffer is too small.
+    /// capacity : The number of characters the buffer can hold, including the terminating null.
+    /// length : The output length of the string, not including the terminating null. This is returned even when the
+    /// buffer is too small, so the call can be repeated with a buffer of at least length + 1 characters.
+    /// Returns true if the value was successfully returned or the buffer was too small. Compare length with
+    /// capacity to know if the value was written.
+    bool getName(char* buffer, size_t capacity, size_t& length) const;
+
     /// Indicates if this property is read-only. If True any attempted edits will fail.
     bool isReadOnly() const;
 
     /// Returns the unique ID of this property.
     std::string id() const;
 
+    /// Gets the unique ID of this property into a string supplied by the caller. When the same string is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// id : The output string.
+    /// Returns true if the value was successfully returned.
+    bool getId(std::string& id) const;
+
+    /// Gets the unique ID of this property, writing it as a null terminated string into a buffer supplied by the caller.
+    /// buffer : The output buffer. Nothing is written if the buffer is too small.
+    /// capacity : The number of characters the buffer can hold, including the terminating null.
+    /// length : The output length of the string, not including the terminating null. This is returned even when the
+    /// buffer is too small, so the call can be repeated with a buffer of at least length + 1 characters.
+    /// Returns true if the value was successfully returned or the buffer was too small. Compare length with
+    /// capacity to know if the value was written.
+    bool getId(char* buffer, size_t capacity, size_t& length) const;
+
     /// Returns the parent of this property.
     Ptr<Base> parent() const;
 
@@ -58,8 +88,8 @@ private:
     virtual bool isReadOnly_raw() const = 0;
     virtual char* id_raw() const = 0;
     virtual Base* parent_raw() const = 0;
-    virtual void placeholderProperty0() {}
-    virtual void placeholderProperty1() {}
+    virtual bool getName_raw(char* buffer, size_t capacity, size_t& length) const = 0;
+    virtual bool getId_raw(char* buffer, size_t capacity, size_t& length) const = 0;
     virtual void placeholderProperty2() {}
     virtual void placeholderProperty3() {}
     virtual void placeholderProperty4() {}
@@ -103,6 +133,26 @@ inline std::string Property::name() const
     return res;
 }
 
+inline bool Property::getName(std::string& name) const
+{
+    size_t length = 0;
+    name.resize(name.capacity());
+    bool res = getName_raw(&name[0], name.size() + 1, length);
+    if(res && length > name.size())
+    {
+        name.resize(length);
+        res = getName_raw(&name[0], name.size() + 1, length);
+    }
+    name.resize(res ? length : 0);
+    return res;
+}
+
+inline bool Property::getName(char* buffer, size_t capacity, size_t& length) const
+{
+    bool res = getName_raw(buffer, capacity, length);
+    return res;
+}
+
 inline bool Property::isReadOnly() const
 {
     bool res = isReadOnly_raw();
@@ -122,6 +172,26 @@ inline std::string Property::id() const
     return res;
 }
 
+inline bool Property::getId(std::string& id) const
+{
+    size_t length = 0;
+    id.resize(id.capacity());
+    bool res = getId_raw(&id[0], id.size() + 1, length);
+    if(res && length > id.size())
+    {
+        id.resize(length);
+        res = getId_raw(&id[0], id.size() + 1, length);
+    }
+    id.resize(res ? length : 0);
+    return res;
+}
+
+inline bool Property::getId(char* buffer, size_t capacity, size_t& length) const
+{
+    bool res = getId_raw(buffer, capacity, length);
+    return res;
+}
+
 inline Ptr<Base> Property::parent() const
 {
     Ptr<Base> res = parent_raw();
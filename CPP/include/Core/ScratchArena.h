@@ -0,0 +1,221 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2023 Autodesk, Inc. All rights reserved.
+//
+// Use of this software is subject to the terms of the Autodesk license
+// agreement provided at the time of installation or download, or which
+// otherwise accompanies this software.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+// THIS CLASS IS USED BY AN API CLIENT
+
+namespace adsk { namespace core {
+
+/// A bump allocator for the short-lived arrays the inline wrappers build to pass arguments to
+/// the raw interface. Memory is taken from large blocks that are kept for reuse, so once a thread
+/// has warmed up its arena, marshalling arrays no longer calls the heap.
+///
+/// Each thread has its own arena, which is used by default. A caller that wants to control the
+/// memory used, for example to give a worker thread a preallocated arena, can create an arena and
+/// make it current for a scope using ScratchArena::Scope. Allocations must be released in the
+/// reverse order they were made, which ScratchArray does automatically.
+class ScratchArena {
+public:
+
+    /// Saves and restores the position of an arena so everything allocated while it is
+    /// alive is released at once.
+    struct Marker
+    {
+        void* block;
+        size_t used;
+    };
+
+    /// Makes an arena the current arena of the calling thread for the lifetime of the scope.
+    class Scope {
+    public:
+        explicit Scope(ScratchArena& arena) : m_previous(currentSlot()) { currentSlot() = &arena; }
+        ~Scope() { currentSlot() = m_previous; }
+
+    private:
+        Scope(const Scope&);
+        Scope& operator=(const Scope&);
+
+        ScratchArena* m_previous;
+    };
+
+    /// Creates an arena.
+    /// initialCapacity : The size in bytes of the first block. Later blocks double in size.
+    explicit ScratchArena(size_t initialCapacity = 64 * 1024)
+        : m_first(nullptr), m_current(nullptr), m_initialCapacity(initialCapacity)
+    {}
+
+    ~ScratchArena()
+    {
+        Block* block = m_first;
+        while (block)
+        {
+            Block* next = block->next;
+            std::free(block);
+            block = next;
+        }
+    }
+
+    /// Returns the current arena of the calling thread.
+    static ScratchArena& current()
+    {
+        ScratchArena* arena = currentSlot();
+        if (arena)
+            return *arena;
+        static thread_local ScratchArena threadArena;
+        currentSlot() = &threadArena;
+        return threadArena;
+    }
+
+    /// Allocates memory from the arena. Returns null if the memory could not be allocated.
+    /// size : The number of bytes to allocate.
+    /// alignment : The required alignment, which must be a power of two no larger than the alignment of std::max_align_t.
+    void* allocate(size_t size, size_t alignment)
+    {
+        if (!m_current && !addBlock(size + alignment))
+            return nullptr;
+        for (;;)
+        {
+            size_t offset = (m_current->used + alignment - 1) & ~(alignment - 1);
+            if (offset + size <= m_current->capacity)
+            {
+                m_current->used = offset + size;
+                return reinterpret_cast<char*>(m_current + 1) + offset;
+            }
+            if (m_current->next)
+            {
+                m_current = m_current->next;
+                m_current->used = 0;
+            }
+            else if (!addBlock(size + alignment))
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    /// Returns the current position of the arena.
+    Marker mark() const
+    {
+        Marker marker = { m_current, m_current ? m_current->used : 0 };
+        return marker;
+    }
+
+    /// Releases everything allocated since the marker was taken.
+    void release(const Marker& marker)
+    {
+        m_current = static_cast<Block*>(marker.block);
+        if (m_current)
+            m_current->used = marker.used;
+        else if (m_first)
+        {
+            m_current = m_first;
+            m_current->used = 0;
+        }
+    }
+
+private:
+    ScratchArena(const ScratchArena&);
+    ScratchArena& operator=(const ScratchArena&);
+
+    struct Block
+    {
+        Block* next;
+        size_t capacity;
+        size_t used;
+        std::max_align_t align;
+    };
+
+    static ScratchArena*& currentSlot()
+    {
+        static thread_local ScratchArena* arena = nullptr;
+        return arena;
+    }
+
+    bool addBlock(size_t minimumSize)
+    {
+        size_t capacity = m_current ? m_current->capacity * 2 : m_initialCapacity;
+        if (capacity < minimumSize)
+            capacity = minimumSize;
+        Block* block = static_cast<Block*>(std::malloc(sizeof(Block) + capacity));
+        if (!block)
+            return false;
+        block->next = nullptr;
+        block->capacity = capacity;
+        block->used = 0;
+        if (m_current)
+        {
+            // Only called when the current block is the last one.
+            m_current->next = block;
+        }
+        else
+        {
+            m_first = block;
+        }
+        m_current = block;
+        return true;
+    }
+
+    Block* m_first;
+    Block* m_current;
+    size_t m_initialCapacity;
+};
+
+/// A temporary array used to marshal arguments to the raw interface. Arrays of up to
+/// inlineCapacity elements are stored in the object itself and larger arrays are taken from the
+/// current ScratchArena and returned to it when the ScratchArray is destroyed. An empty
+/// ScratchArray converts to a null pointer.
+template <class T, size_t inlineCapacity = 16>
+class ScratchArray {
+    static_assert(std::is_trivially_destructible<T>::value, "ScratchArray only holds trivially destructible elements");
+
+public:
+
+    explicit ScratchArray(size_t size) : m_data(nullptr), m_arena(nullptr)
+    {
+        if (size == 0)
+            return;
+        if (size <= inlineCapacity)
+        {
+            m_data = reinterpret_cast<T*>(m_inline);
+            return;
+        }
+        m_arena = &ScratchArena::current();
+        m_marker = m_arena->mark();
+        m_data = static_cast<T*>(m_arena->allocate(size * sizeof(T), alignof(T)));
+        if (!m_data)
+            throw std::bad_alloc();
+    }
+
+    ~ScratchArray()
+    {
+        if (m_arena)
+            m_arena->release(m_marker);
+    }
+
+    T* get() const { return m_data; }
+    operator T*() const { return m_data; }
+
+private:
+    ScratchArray(const ScratchArray&);
+    ScratchArray& operator=(const ScratchArray&);
+
+    T* m_data;
+    ScratchArena* m_arena;
+    ScratchArena::Marker m_marker;
+    alignas(T) unsigned char m_inline[inlineCapacity * sizeof(T)];
+};
+
+}// namespace core
+}// namespace adsk
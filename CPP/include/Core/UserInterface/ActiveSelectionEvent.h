@@ -54,6 +54,13 @@ public:
     /// Returns true if removal of the handler was successful.
     bool remove(ActiveSelectionEventHandler* handler);
 
+    /// Adds a handler that can have the firings of this event coalesced, as described on EventArgs.droppedCount.
+    /// handler : The handler object to be called when this event is fired.
+    /// isCoalescing : Specifies if the firings are coalesced for this handler. If false, the handler is added in the
+    /// same way as with the other add method.
+    /// Returns true if the addition of the handler was successful.
+    bool add(ActiveSelectionEventHandler* handler, bool isCoalescing);
+
     ADSK_CORE_ACTIVESELECTIONEVENT_API static const char* classType();
     ADSK_CORE_ACTIVESELECTIONEVENT_API const char* objectType() const override;
     ADSK_CORE_ACTIVESELECTIONEVENT_API void* queryInterface(const char* id) const override;
@@ -64,6 +71,7 @@ private:
     // Raw interface
     virtual bool add_raw(ActiveSelectionEventHandler* handler) = 0;
     virtual bool remove_raw(ActiveSelectionEventHandler* handler) = 0;
+    virtual bool addWithCoalescing_raw(ActiveSelectionEventHandler* handler, bool isCoalescing) = 0;
 };
 
 // Inline wrappers
@@ -79,6 +87,12 @@ inline bool ActiveSelectionEvent::remove(ActiveSelectionEventHandler* handler)
     bool res = remove_raw(handler);
     return res;
 }
+
+inline bool ActiveSelectionEvent::add(ActiveSelectionEventHandler* handler, bool isCoalescing)
+{
+    bool res = addWithCoalescing_raw(handler, isCoalescing);
+    return res;
+}
 }// namespace core
 }// namespace adsk
 
@@ -11,7 +11,9 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -121,9 +123,33 @@ public:
     /// Returns the CommandDefinition with the specified ID or null if there isn't a command definition with that ID.
     Ptr<CommandDefinition> itemById(const std::string& id) const;
 
+    /// Returns the items that match a set of unique IDs in a single call, instead of one call to itemById for each ID.
+    /// ids : The unique IDs of the items to return.
+    /// Returns an array the same length as ids where each entry is the command definition with the corresponding id, or
+    /// null if the id doesn't match an item within the collection.
+    std::vector<Ptr<CommandDefinition>> itemsById(const std::vector<std::string>& ids) const;
+
     /// Gets the number of command definitions.
     size_t count() const;
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<CommandDefinition>> asArray() const;
+
+    /// Gets and sets if the command definitions of the calling add-in are loaded lazily. When true, the images of
+    /// the resource folder of a definition created by the add-in aren't read, and the definition isn't registered
+    /// with the command system, until a control that uses the definition is first displayed, or the definition
+    /// is executed or its properties are changed. Calls such as addButtonDefinition then return almost
+    /// immediately, which moves the cost of definitions that are never shown out of the startup of Fusion. An
+    /// error in the resource folder, such as a missing folder, is reported in the log when the images are loaded
+    /// rather than when the definition is created.
+    /// 
+    /// The setting applies only to the add-in that sets it and to the definitions it creates afterwards, so it
+    /// should be set at the start of the run function. The default is false. Deferred work appears in the
+    /// StartupTrace with StartupTraceEntry.isDeferred set to true.
+    bool isLazyLoading() const;
+    bool isLazyLoading(bool value);
+
     typedef CommandDefinition iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -141,6 +167,10 @@ private:
     virtual CommandDefinition* item_raw(size_t index) const = 0;
     virtual CommandDefinition* itemById_raw(const char* id) const = 0;
     virtual size_t count_raw() const = 0;
+    virtual CommandDefinition** asArray_raw(size_t& return_size) const = 0;
+    virtual CommandDefinition** itemsById_raw(const char** ids, size_t ids_size, size_t& return_size) const = 0;
+    virtual bool isLazyLoading_raw() const = 0;
+    virtual bool isLazyLoading_raw(bool value) = 0;
 };
 
 // Inline wrappers
@@ -175,15 +205,60 @@ inline Ptr<CommandDefinition> CommandDefinitions::itemById(const std::string& id
     return res;
 }
 
+inline std::vector<Ptr<CommandDefinition>> CommandDefinitions::itemsById(const std::vector<std::string>& ids) const
+{
+    ScratchArray<const char*> ids_(ids.size());
+    for(size_t i = 0; i < ids.size(); ++i)
+    {
+        ids_[i] = ids[i].c_str();
+    }
+
+    std::vector<Ptr<CommandDefinition>> res;
+    size_t s;
+
+    CommandDefinition** p= itemsById_raw(ids_, ids.size(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 inline size_t CommandDefinitions::count() const
 {
     size_t res = count_raw();
     return res;
 }
 
+inline std::vector<Ptr<CommandDefinition>> CommandDefinitions::asArray() const
+{
+    std::vector<Ptr<CommandDefinition>> res;
+    size_t s;
+
+    CommandDefinition** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
+inline bool CommandDefinitions::isLazyLoading() const
+{
+    bool res = isLazyLoading_raw();
+    return res;
+}
+
+inline bool CommandDefinitions::isLazyLoading(bool value)
+{
+    return isLazyLoading_raw(value);
+}
+
 template <class OutputIterator> inline void CommandDefinitions::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
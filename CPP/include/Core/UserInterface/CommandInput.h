@@ -44,9 +44,39 @@ public:
     /// Gets the unique identifier for this input in the command's CommandInputs.
     std::string id() const;
 
+    /// Gets the unique identifier for this input into a string supplied by the caller. When the same string is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// id : The output string.
+    /// Returns true if the value was successfully returned.
+    bool getId(std::string& id) const;
+
+    /// Gets the unique identifier for this input, writing it as a null terminated string into a buffer supplied by the caller.
+    /// buffer : The output buffer. Nothing is written if the buffer is too small.
+    /// capacity : The number of characters the buffer can hold, including the terminating null.
+    /// length : The output length of the string, not including the terminating null. This is returned even when the
+    /// buffer is too small, so the call can be repeated with a buffer of at least length + 1 characters.
+    /// Returns true if the value was successfully returned or the buffer was too small. Compare length with
+    /// capacity to know if the value was written.
+    bool getId(char* buffer, size_t capacity, size_t& length) const;
+
     /// Gets the user visible name of this input.
     std::string name() const;
 
+    /// Gets the user visible name of this input into a string supplied by the caller. When the same string is passed to repeated
+    /// calls, its storage is reused and no memory is allocated once it is large enough.
+    /// name : The output string.
+    /// Returns true if the value was successfully returned.
+    bool getName(std::string& name) const;
+
+    /// Gets the user visible name of this input, writing it as a null terminated string into a buffer supplied by the caller.
+    /// buffer : The output buffer. Nothing is written if the buffer is too small.
+    /// capacity : The number of characters the buffer can hold, including the terminating null.
+    /// length : The output length of the string, not including the terminating null. This is returned even when the
+    /// buffer is too small, so the call can be repeated with a buffer of at least length + 1 characters.
+    /// Returns true if the value was successfully returned or the buffer was too small. Compare length with
+    /// capacity to know if the value was written.
+    bool getName(char* buffer, size_t capacity, size_t& length) const;
+
     /// Gets or sets if this input is currently enabled or disabled for user interaction.
     /// 
     /// Currently, the isEnabled property does not disable SelectionCommandInput objects but
@@ -123,8 +153,8 @@ private:
     virtual bool tooltipDescription_raw(const char* value) = 0;
     virtual CommandInput* parentCommandInput_raw() const = 0;
     virtual bool deleteMe_raw() = 0;
-    virtual void placeholderCommandInput0() {}
-    virtual void placeholderCommandInput1() {}
+    virtual bool getId_raw(char* buffer, size_t capacity, size_t& length) const = 0;
+    virtual bool getName_raw(char* buffer, size_t capacity, size_t& length) const = 0;
     virtual void placeholderCommandInput2() {}
     virtual void placeholderCommandInput3() {}
     virtual void placeholderCommandInput4() {}
@@ -160,6 +190,26 @@ inline std::string CommandInput::id() const
     return res;
 }
 
+inline bool CommandInput::getId(std::string& id) const
+{
+    size_t length = 0;
+    id.resize(id.capacity());
+    bool res = getId_raw(&id[0], id.size() + 1, length);
+    if(res && length > id.size())
+    {
+        id.resize(length);
+        res = getId_raw(&id[0], id.size() + 1, length);
+    }
+    id.resize(res ? length : 0);
+    return res;
+}
+
+inline bool CommandInput::getId(char* buffer, size_t capacity, size_t& length) const
+{
+    bool res = getId_raw(buffer, capacity, length);
+    return res;
+}
+
 inline std::string CommandInput::name() const
 {
     std::string res;
@@ -173,6 +223,26 @@ inline std::string CommandInput::name() const
     return res;
 }
 
+inline bool CommandInput::getName(std::string& name) const
+{
+    size_t length = 0;
+    name.resize(name.capacity());
+    bool res = getName_raw(&name[0], name.size() + 1, length);
+    if(res && length > name.size())
+    {
+        name.resize(length);
+        res = getName_raw(&name[0], name.size() + 1, length);
+    }
+    name.resize(res ? length : 0);
+    return res;
+}
+
+inline bool CommandInput::getName(char* buffer, size_t capacity, size_t& length) const
+{
+    bool res = getName_raw(buffer, capacity, length);
+    return res;
+}
+
 inline bool CommandInput::isEnabled() const
 {
     bool res = isEnabled_raw();
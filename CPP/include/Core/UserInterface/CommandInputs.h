@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
 #include <vector>
 
@@ -76,6 +77,12 @@ public:
     /// Returns the specified command input or null if the input ID doesn't match an existing command input.
     Ptr<CommandInput> itemById(const std::string& id) const;
 
+    /// Returns the items that match a set of unique IDs in a single call, instead of one call to itemById for each ID.
+    /// ids : The unique IDs of the items to return.
+    /// Returns an array the same length as ids where each entry is the command input with the corresponding id, or
+    /// null if the id doesn't match an item within the collection.
+    std::vector<Ptr<CommandInput>> itemsById(const std::vector<std::string>& ids) const;
+
     /// Gets the number of inputs.
     size_t count() const;
 
@@ -364,6 +371,10 @@ public:
     /// Returns the created TriadCommandInput object or null if the creation failed.
     Ptr<TriadCommandInput> addTriadCommandInput(const std::string& id, const Ptr<Matrix3D>& transform);
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<CommandInput>> asArray() const;
+
     typedef CommandInput iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -402,6 +413,8 @@ private:
     virtual AngleValueCommandInput* addAngleValueCommandInput_raw(const char* id, const char* name, ValueInput* initialValue) = 0;
     virtual BrowserCommandInput* addBrowserCommandInput_raw(const char* id, const char* name, const char* htmlFileURL, int minimumHeight, int maximumHeight) = 0;
     virtual TriadCommandInput* addTriadCommandInput_raw(const char* id, Matrix3D* transform) = 0;
+    virtual CommandInput** asArray_raw(size_t& return_size) const = 0;
+    virtual CommandInput** itemsById_raw(const char** ids, size_t ids_size, size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -424,6 +437,26 @@ inline Ptr<CommandInput> CommandInputs::itemById(const std::string& id) const
     return res;
 }
 
+inline std::vector<Ptr<CommandInput>> CommandInputs::itemsById(const std::vector<std::string>& ids) const
+{
+    ScratchArray<const char*> ids_(ids.size());
+    for(size_t i = 0; i < ids.size(); ++i)
+    {
+        ids_[i] = ids[i].c_str();
+    }
+
+    std::vector<Ptr<CommandInput>> res;
+    size_t s;
+
+    CommandInput** p= itemsById_raw(ids_, ids.size(), s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 inline size_t CommandInputs::count() const
 {
     size_t res = count_raw();
@@ -568,9 +601,23 @@ inline Ptr<TriadCommandInput> CommandInputs::addTriadCommandInput(const std::str
     return res;
 }
 
+inline std::vector<Ptr<CommandInput>> CommandInputs::asArray() const
+{
+    std::vector<Ptr<CommandInput>> res;
+    size_t s;
+
+    CommandInput** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void CommandInputs::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
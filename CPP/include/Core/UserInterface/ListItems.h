@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -73,6 +74,10 @@ public:
     /// Returns true if successful.
     bool clear();
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<ListItem>> asArray() const;
+
     typedef ListItem iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -89,6 +94,7 @@ private:
     virtual ListItem* item_raw(size_t index) const = 0;
     virtual size_t count_raw() const = 0;
     virtual bool clear_raw() = 0;
+    virtual ListItem** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -123,9 +129,23 @@ inline bool ListItems::clear()
     return res;
 }
 
+inline std::vector<Ptr<ListItem>> ListItems::asArray() const
+{
+    std::vector<Ptr<ListItem>> res;
+    size_t s;
+
+    ListItem** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void ListItems::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -45,6 +45,14 @@ public:
     /// Returns true if the handler was found and removed from the set of event handlers.
     bool remove(MouseEventHandler* handler);
 
+    /// Adds a handler that can have the firings of this event coalesced, as described on EventArgs.droppedCount.
+    /// Coalescing is supported by Command.mouseMove and Command.mouseDrag, and fails for the other mouse events.
+    /// handler : The handler object to be called when this event is fired.
+    /// isCoalescing : Specifies if the firings are coalesced for this handler. If false, the handler is added in the
+    /// same way as with the other add method.
+    /// Returns true if the addition of the handler was successful.
+    bool add(MouseEventHandler* handler, bool isCoalescing);
+
     ADSK_CORE_MOUSEEVENT_API static const char* classType();
     ADSK_CORE_MOUSEEVENT_API const char* objectType() const override;
     ADSK_CORE_MOUSEEVENT_API void* queryInterface(const char* id) const override;
@@ -55,6 +63,7 @@ private:
     // Raw interface
     virtual bool add_raw(MouseEventHandler* handler) = 0;
     virtual bool remove_raw(MouseEventHandler* handler) = 0;
+    virtual bool addWithCoalescing_raw(MouseEventHandler* handler, bool isCoalescing) = 0;
 };
 
 // Inline wrappers
@@ -70,6 +79,12 @@ inline bool MouseEvent::remove(MouseEventHandler* handler)
     bool res = remove_raw(handler);
     return res;
 }
+
+inline bool MouseEvent::add(MouseEventHandler* handler, bool isCoalescing)
+{
+    bool res = addWithCoalescing_raw(handler, isCoalescing);
+    return res;
+}
 }// namespace core
 }// namespace adsk
 
@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -93,6 +94,10 @@ public:
     /// Returns the newly created palette or null in the case the creation failed.
     Ptr<Palette> add2(const std::string& id, const std::string& name, const std::string& htmlFileURL, bool isVisible, bool showCloseButton, bool isResizable, int width = 200, int height = 200);
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Palette>> asArray() const;
+
     typedef Palette iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -109,6 +114,7 @@ private:
     virtual Palette* itemById_raw(const char* id) const = 0;
     virtual size_t count_raw() const = 0;
     virtual Palette* add2_raw(const char* id, const char* name, const char* htmlFileURL, bool isVisible, bool showCloseButton, bool isResizable, int width, int height) = 0;
+    virtual Palette** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -143,9 +149,23 @@ inline Ptr<Palette> Palettes::add2(const std::string& id, const std::string& nam
     return res;
 }
 
+inline std::vector<Ptr<Palette>> Palettes::asArray() const
+{
+    std::vector<Ptr<Palette>> res;
+    size_t s;
+
+    Palette** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void Palettes::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -10,6 +10,7 @@
 
 #pragma once
 #include "CommandInput.h"
+#include "../ScratchArena.h"
 #include <string>
 #include <vector>
 
@@ -220,14 +221,13 @@ inline std::vector<std::string> SelectionCommandInput::selectionFilters() const
 
 inline bool SelectionCommandInput::selectionFilters(const std::vector<std::string>& value)
 {
-    const char** value_ = value.empty() ? nullptr : (new const char*[value.size()]);
+    ScratchArray<const char*> value_(value.size());
     for(size_t i = 0; i < value.size(); ++i)
     {
         value_[i] = value[i].c_str();
     }
 
     bool res = selectionFilters_raw(value_, value.size());
-    delete[] value_;
     return res;
 }
 
@@ -178,7 +178,7 @@ inline std::vector<Ptr<Selection>> Selections::asArray()
 
 template <class OutputIterator> inline void Selections::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
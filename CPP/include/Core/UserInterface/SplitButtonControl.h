@@ -10,6 +10,7 @@
 
 #pragma once
 #include "ToolbarControl.h"
+#include "../ScratchArena.h"
 #include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
@@ -92,12 +93,11 @@ inline std::vector<Ptr<CommandDefinition>> SplitButtonControl::additionalDefinit
 
 inline bool SplitButtonControl::additionalDefinitions(const std::vector<Ptr<CommandDefinition>>& value)
 {
-    CommandDefinition** value_ = new CommandDefinition*[value.size()];
+    ScratchArray<CommandDefinition*> value_(value.size());
     for(size_t i=0; i<value.size(); ++i)
         value_[i] = value[i].get();
 
     bool res = additionalDefinitions_raw(value_, value.size());
-    delete[] value_;
     return res;
 }
 }// namespace core
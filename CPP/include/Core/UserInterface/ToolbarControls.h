@@ -11,6 +11,7 @@
 #pragma once
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
+#include "../ScratchArena.h"
 #include <string>
 #include <vector>
 
@@ -117,6 +118,10 @@ public:
     /// Returns the newly created SplitButtonControl object or null if the creation fails.
     Ptr<SplitButtonControl> addSplitButton(const Ptr<CommandDefinition>& defaultDefinition, const std::vector<Ptr<CommandDefinition>>& additionalDefinitions, bool showLastUsed, const std::string& id = "", const std::string& positionID = "", bool isBefore = true);
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<ToolbarControl>> asArray() const;
+
     typedef ToolbarControl iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -135,6 +140,7 @@ private:
     virtual DropDownControl* addDropDown_raw(const char* text, const char* resourceFolder, const char* id, const char* positionID, bool isBefore) = 0;
     virtual SeparatorControl* addSeparator_raw(const char* id, const char* positionID, bool isBefore) = 0;
     virtual SplitButtonControl* addSplitButton_raw(CommandDefinition* defaultDefinition, CommandDefinition** additionalDefinitions, size_t additionalDefinitions_size, bool showLastUsed, const char* id, const char* positionID, bool isBefore) = 0;
+    virtual ToolbarControl** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -177,18 +183,31 @@ inline Ptr<SeparatorControl> ToolbarControls::addSeparator(const std::string& id
 
 inline Ptr<SplitButtonControl> ToolbarControls::addSplitButton(const Ptr<CommandDefinition>& defaultDefinition, const std::vector<Ptr<CommandDefinition>>& additionalDefinitions, bool showLastUsed, const std::string& id, const std::string& positionID, bool isBefore)
 {
-    CommandDefinition** additionalDefinitions_ = new CommandDefinition*[additionalDefinitions.size()];
+    ScratchArray<CommandDefinition*> additionalDefinitions_(additionalDefinitions.size());
     for(size_t i=0; i<additionalDefinitions.size(); ++i)
         additionalDefinitions_[i] = additionalDefinitions[i].get();
 
     Ptr<SplitButtonControl> res = addSplitButton_raw(defaultDefinition.get(), additionalDefinitions_, additionalDefinitions.size(), showLastUsed, id.c_str(), positionID.c_str(), isBefore);
-    delete[] additionalDefinitions_;
+    return res;
+}
+
+inline std::vector<Ptr<ToolbarControl>> ToolbarControls::asArray() const
+{
+    std::vector<Ptr<ToolbarControl>> res;
+    size_t s;
+
+    ToolbarControl** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
     return res;
 }
 
 template <class OutputIterator> inline void ToolbarControls::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -58,6 +59,10 @@ public:
     /// Returns the newly created tab or null in the case the creation failed.
     Ptr<ToolbarTab> add(const std::string& id, const std::string& name);
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<ToolbarTab>> asArray() const;
+
     typedef ToolbarTab iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -73,6 +78,7 @@ private:
     virtual ToolbarTab* itemById_raw(const char* id) const = 0;
     virtual size_t count_raw() const = 0;
     virtual ToolbarTab* add_raw(const char* id, const char* name) = 0;
+    virtual ToolbarTab** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -101,9 +107,23 @@ inline Ptr<ToolbarTab> ToolbarTabs::add(const std::string& id, const std::string
     return res;
 }
 
+inline std::vector<Ptr<ToolbarTab>> ToolbarTabs::asArray() const
+{
+    std::vector<Ptr<ToolbarTab>> res;
+    size_t s;
+
+    ToolbarTab** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void ToolbarTabs::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -50,6 +51,10 @@ public:
     /// Gets the number of Toolbar objects in the collection.
     size_t count() const;
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Toolbar>> asArray() const;
+
     typedef Toolbar iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -64,6 +69,7 @@ private:
     virtual Toolbar* item_raw(size_t index) const = 0;
     virtual Toolbar* itemById_raw(const char* id) const = 0;
     virtual size_t count_raw() const = 0;
+    virtual Toolbar** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -86,9 +92,23 @@ inline size_t Toolbars::count() const
     return res;
 }
 
+inline std::vector<Ptr<Toolbar>> Toolbars::asArray() const
+{
+    std::vector<Ptr<Toolbar>> res;
+    size_t s;
+
+    Toolbar** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void Toolbars::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;
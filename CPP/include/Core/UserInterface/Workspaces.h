@@ -12,6 +12,7 @@
 #include "../Base.h"
 #include "../CoreTypeDefs.h"
 #include <string>
+#include <vector>
 
 // THIS CLASS WILL BE VISIBLE TO AN API CLIENT.
 // THIS HEADER FILE WILL BE GENERATED FROM NIDL.
@@ -59,6 +60,10 @@ public:
     /// Returns the created workspace or null if the creation failed.
     Ptr<Workspace> add(const std::string& productType, const std::string& id, const std::string& name, const std::string& resourceFolder);
 
+    /// Gets all of the items in the collection as an array.
+    /// Returns an array of the items in the collection.
+    std::vector<Ptr<Workspace>> asArray() const;
+
     typedef Workspace iterable_type;
     template <class OutputIterator> void copyTo(OutputIterator result);
 
@@ -74,6 +79,7 @@ private:
     virtual Workspace* itemById_raw(const char* id) const = 0;
     virtual size_t count_raw() const = 0;
     virtual Workspace* add_raw(const char* productType, const char* id, const char* name, const char* resourceFolder) = 0;
+    virtual Workspace** asArray_raw(size_t& return_size) const = 0;
 };
 
 // Inline wrappers
@@ -102,9 +108,23 @@ inline Ptr<Workspace> Workspaces::add(const std::string& productType, const std:
     return res;
 }
 
+inline std::vector<Ptr<Workspace>> Workspaces::asArray() const
+{
+    std::vector<Ptr<Workspace>> res;
+    size_t s;
+
+    Workspace** p= asArray_raw(s);
+    if(p)
+    {
+        res.assign(p, p+s);
+        DeallocateArray(p);
+    }
+    return res;
+}
+
 template <class OutputIterator> inline void Workspaces::copyTo(OutputIterator result)
 {
-    for (size_t i = 0;i < count();++i)
+    for (size_t i = 0, n = count();i < n;++i)
     {
         *result = item(i);
         ++result;